@@ -0,0 +1,3121 @@
+// Generated by tools/generate_entity_table.py from tools/entities.json. Do not edit by hand.
+#pragma once
+#ifndef __HTML_ENTITIES_TABLE__
+#define __HTML_ENTITIES_TABLE__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace html_entities_decoder
+{
+	namespace entity_table
+	{
+		struct entity
+		{
+			std::uint16_t name_offset;
+			std::uint8_t name_length;
+			std::uint8_t code_point_count;
+			char32_t code_points[2];
+		};
+
+		// Node of the trie of legacy names, which may appear without the trailing ';'
+		struct legacy_node
+		{
+			std::uint16_t first_edge;
+			std::uint8_t edge_count;
+			std::uint16_t entity;		// entity index + 1, 0 if no legacy name ends here
+		};
+
+		struct legacy_edge
+		{
+			char label;
+			std::uint16_t target;
+		};
+
+		inline constexpr std::size_t entity_count = 2125;
+		inline constexpr std::size_t max_name_length = 31;
+		inline constexpr std::size_t legacy_node_count = 423;
+		inline constexpr std::size_t legacy_edge_count = 422;
+		inline constexpr std::uint32_t bucket_count = 512;
+		inline constexpr std::uint32_t slot_count = 4096;
+		inline constexpr std::uint32_t name_hash_offset = 2166136261u;
+		inline constexpr std::uint32_t name_hash_prime = 16777619u;
+
+		constexpr std::uint32_t name_hash_step(std::uint32_t hash, std::uint32_t code_unit) noexcept
+		{
+			return (hash ^ code_unit) * name_hash_prime;
+		}
+
+		constexpr std::uint32_t slot_of(std::uint32_t hash, std::uint32_t seed) noexcept
+		{
+			hash ^= seed;
+			hash ^= hash >> 16;
+			hash *= 0x7FEB352Du;
+			hash ^= hash >> 15;
+			hash *= 0x846CA68Bu;
+			hash ^= hash >> 16;
+			return hash % slot_count;
+		}
+
+		inline constexpr char names[] =
+			"AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogonAopfApplyFunctionAringAscrAssignAtildeAum"
+			"lBackslashBarvBarwedBcyBecauseBernoullisBetaBfrBopfBreveBscrBumpeqCHcyCOPYCacuteCapCapitalDiffer"
+			"entialDCayleysCcaronCcedilCcircCconintCdotCedillaCenterDotCfrChiCircleDotCircleMinusCirclePlusCi"
+			"rcleTimesClockwiseContourIntegralCloseCurlyDoubleQuoteCloseCurlyQuoteColonColoneCongruentConintC"
+			"ontourIntegralCopfCoproductCounterClockwiseContourIntegralCrossCscrCupCupCapDDDDotrahdDJcyDScyDZ"
+			"cyDaggerDarrDashvDcaronDcyDelDeltaDfrDiacriticalAcuteDiacriticalDotDiacriticalDoubleAcuteDiacrit"
+			"icalGraveDiacriticalTildeDiamondDifferentialDDopfDotDotDotDotEqualDoubleContourIntegralDoubleDot"
+			"DoubleDownArrowDoubleLeftArrowDoubleLeftRightArrowDoubleLeftTeeDoubleLongLeftArrowDoubleLongLeft"
+			"RightArrowDoubleLongRightArrowDoubleRightArrowDoubleRightTeeDoubleUpArrowDoubleUpDownArrowDouble"
+			"VerticalBarDownArrowDownArrowBarDownArrowUpArrowDownBreveDownLeftRightVectorDownLeftTeeVectorDow"
+			"nLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVectorDownRightVectorBarDownTeeDownTeeArr"
+			"owDownarrowDscrDstrokENGETHEacuteEcaronEcircEcyEdotEfrEgraveElementEmacrEmptySmallSquareEmptyVer"
+			"ySmallSquareEogonEopfEpsilonEqualEqualTildeEquilibriumEscrEsimEtaEumlExistsExponentialEFcyFfrFil"
+			"ledSmallSquareFilledVerySmallSquareFopfForAllFouriertrfFscrGJcyGTGammaGammadGbreveGcedilGcircGcy"
+			"GdotGfrGgGopfGreaterEqualGreaterEqualLessGreaterFullEqualGreaterGreaterGreaterLessGreaterSlantEq"
+			"ualGreaterTildeGscrGtHARDcyHacekHatHcircHfrHilbertSpaceHopfHorizontalLineHscrHstrokHumpDownHumpH"
+			"umpEqualIEcyIJligIOcyIacuteIcircIcyIdotIfrIgraveImImacrImaginaryIImpliesIntIntegralIntersectionI"
+			"nvisibleCommaInvisibleTimesIogonIopfIotaIscrItildeIukcyIumlJcircJcyJfrJopfJscrJsercyJukcyKHcyKJc"
+			"yKappaKcedilKcyKfrKopfKscrLJcyLTLacuteLambdaLangLaplacetrfLarrLcaronLcedilLcyLeftAngleBracketLef"
+			"tArrowLeftArrowBarLeftArrowRightArrowLeftCeilingLeftDoubleBracketLeftDownTeeVectorLeftDownVector"
+			"LeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTeeLeftTeeArrowLeftTeeVectorLeftTrian"
+			"gleLeftTriangleBarLeftTriangleEqualLeftUpDownVectorLeftUpTeeVectorLeftUpVectorLeftUpVectorBarLef"
+			"tVectorLeftVectorBarLeftarrowLeftrightarrowLessEqualGreaterLessFullEqualLessGreaterLessLessLessS"
+			"lantEqualLessTildeLfrLlLleftarrowLmidotLongLeftArrowLongLeftRightArrowLongRightArrowLongleftarro"
+			"wLongleftrightarrowLongrightarrowLopfLowerLeftArrowLowerRightArrowLscrLshLstrokLtMapMcyMediumSpa"
+			"ceMellintrfMfrMinusPlusMopfMscrMuNJcyNacuteNcaronNcedilNcyNegativeMediumSpaceNegativeThickSpaceN"
+			"egativeThinSpaceNegativeVeryThinSpaceNestedGreaterGreaterNestedLessLessNewLineNfrNoBreakNonBreak"
+			"ingSpaceNopfNotNotCongruentNotCupCapNotDoubleVerticalBarNotElementNotEqualNotEqualTildeNotExists"
+			"NotGreaterNotGreaterEqualNotGreaterFullEqualNotGreaterGreaterNotGreaterLessNotGreaterSlantEqualN"
+			"otGreaterTildeNotHumpDownHumpNotHumpEqualNotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNo"
+			"tLessNotLessEqualNotLessGreaterNotLessLessNotLessSlantEqualNotLessTildeNotNestedGreaterGreaterNo"
+			"tNestedLessLessNotPrecedesNotPrecedesEqualNotPrecedesSlantEqualNotReverseElementNotRightTriangle"
+			"NotRightTriangleBarNotRightTriangleEqualNotSquareSubsetNotSquareSubsetEqualNotSquareSupersetNotS"
+			"quareSupersetEqualNotSubsetNotSubsetEqualNotSucceedsNotSucceedsEqualNotSucceedsSlantEqualNotSucc"
+			"eedsTildeNotSupersetNotSupersetEqualNotTildeNotTildeEqualNotTildeFullEqualNotTildeTildeNotVertic"
+			"alBarNscrNtildeNuOEligOacuteOcircOcyOdblacOfrOgraveOmacrOmegaOmicronOopfOpenCurlyDoubleQuoteOpen"
+			"CurlyQuoteOrOscrOslashOtildeOtimesOumlOverBarOverBraceOverBracketOverParenthesisPartialDPcyPfrPh"
+			"iPiPlusMinusPoincareplanePopfPrPrecedesPrecedesEqualPrecedesSlantEqualPrecedesTildePrimeProductP"
+			"roportionProportionalPscrPsiQUOTQfrQopfQscrRBarrREGRacuteRangRarrRarrtlRcaronRcedilRcyReReverseE"
+			"lementReverseEquilibriumReverseUpEquilibriumRfrRhoRightAngleBracketRightArrowRightArrowBarRightA"
+			"rrowLeftArrowRightCeilingRightDoubleBracketRightDownTeeVectorRightDownVectorRightDownVectorBarRi"
+			"ghtFloorRightTeeRightTeeArrowRightTeeVectorRightTriangleRightTriangleBarRightTriangleEqualRightU"
+			"pDownVectorRightUpTeeVectorRightUpVectorRightUpVectorBarRightVectorRightVectorBarRightarrowRopfR"
+			"oundImpliesRrightarrowRscrRshRuleDelayedSHCHcySHcySOFTcySacuteScScaronScedilScircScySfrShortDown"
+			"ArrowShortLeftArrowShortRightArrowShortUpArrowSigmaSmallCircleSopfSqrtSquareSquareIntersectionSq"
+			"uareSubsetSquareSubsetEqualSquareSupersetSquareSupersetEqualSquareUnionSscrStarSubSubsetSubsetEq"
+			"ualSucceedsSucceedsEqualSucceedsSlantEqualSucceedsTildeSuchThatSumSupSupersetSupersetEqualSupset"
+			"THORNTRADETSHcyTScyTabTauTcaronTcedilTcyTfrThereforeThetaThickSpaceThinSpaceTildeTildeEqualTilde"
+			"FullEqualTildeTildeTopfTripleDotTscrTstrokUacuteUarrUarrocirUbrcyUbreveUcircUcyUdblacUfrUgraveUm"
+			"acrUnderBarUnderBraceUnderBracketUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrow"
+			"DownArrowUpDownArrowUpEquilibriumUpTeeUpTeeArrowUparrowUpdownarrowUpperLeftArrowUpperRightArrowU"
+			"psiUpsilonUringUscrUtildeUumlVDashVbarVcyVdashVdashlVeeVerbarVertVerticalBarVerticalLineVertical"
+			"SeparatorVerticalTildeVeryThinSpaceVfrVopfVscrVvdashWcircWedgeWfrWopfWscrXfrXiXopfXscrYAcyYIcyYU"
+			"cyYacuteYcircYcyYfrYopfYscrYumlZHcyZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabrevea"
+			"cacEacdacircacuteacyaeligafafragravealefsymalephalphaamacramalgampandandandanddandslopeandvangan"
+			"geangleangmsdangmsdaaangmsdabangmsdacangmsdadangmsdaeangmsdafangmsdagangmsdahangrtangrtvbangrtvb"
+			"dangsphangstangzarraogonaopfapapEapacirapeapidaposapproxapproxeqaringascrastasympasympeqatildeau"
+			"mlawconintawintbNotbackcongbackepsilonbackprimebacksimbacksimeqbarveebarwedbarwedgebbrkbbrktbrkb"
+			"congbcybdquobecausbecausebemptyvbepsibernoubetabethbetweenbfrbigcapbigcircbigcupbigodotbigoplusb"
+			"igotimesbigsqcupbigstarbigtriangledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozengeblack"
+			"squareblacktriangleblacktriangledownblacktriangleleftblacktrianglerightblankblk12blk14blk34block"
+			"bnebnequivbnotbopfbotbottombowtieboxDLboxDRboxDlboxDrboxHboxHDboxHUboxHdboxHuboxULboxURboxUlboxU"
+			"rboxVboxVHboxVLboxVRboxVhboxVlboxVrboxboxboxdLboxdRboxdlboxdrboxhboxhDboxhUboxhdboxhuboxminusbox"
+			"plusboxtimesboxuLboxuRboxulboxurboxvboxvHboxvLboxvRboxvhboxvlboxvrbprimebrevebrvbarbscrbsemibsim"
+			"bsimebsolbsolbbsolhsubbullbulletbumpbumpEbumpebumpeqcacutecapcapandcapbrcupcapcapcapcupcapdotcap"
+			"scaretcaronccapsccaronccedilccircccupsccupssmcdotcedilcemptyvcentcenterdotcfrchcycheckcheckmarkc"
+			"hicircirEcirccirceqcirclearrowleftcirclearrowrightcircledRcircledScircledastcircledcirccircledda"
+			"shcirecirfnintcirmidcirscirclubsclubsuitcoloncolonecoloneqcommacommatcompcompfncomplementcomplex"
+			"escongcongdotconintcopfcoprodcopycopysrcrarrcrosscscrcsubcsubecsupcsupectdotcudarrlcudarrrcueprc"
+			"uesccularrcularrpcupcupbrcapcupcapcupcupcupdotcuporcupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyv"
+			"eecurlywedgecurrencurvearrowleftcurvearrowrightcuveecuwedcwconintcwintcylctydArrdHardaggerdaleth"
+			"darrdashdashvdbkarowdblacdcarondcyddddaggerddarrddotseqdegdeltademptyvdfishtdfrdharldharrdiamdia"
+			"monddiamondsuitdiamsdiedigammadisindivdividedivideontimesdivonxdjcydlcorndlcropdollardopfdotdote"
+			"qdoteqdotdotminusdotplusdotsquaredoublebarwedgedownarrowdowndownarrowsdownharpoonleftdownharpoon"
+			"rightdrbkarowdrcorndrcropdscrdscydsoldstrokdtdotdtridtrifduarrduhardwangledzcydzigrarreDDoteDote"
+			"acuteeasterecaronecirecircecolonecyedoteeefDotefregegraveegsegsdotelelintersellelselsdotemacremp"
+			"tyemptysetemptyvemspemsp13emsp14engenspeogoneopfepareparsleplusepsiepsilonepsiveqcirceqcoloneqsi"
+			"meqslantgtreqslantlessequalsequestequivequivDDeqvparslerDoterarrescresdotesimetaetheumleuroexcle"
+			"xistexpectationexponentialefallingdotseqfcyfemaleffiligffligfflligffrfiligfjligflatflligfltnsfno"
+			"ffopfforallforkforkvfpartintfrac12frac13frac14frac15frac16frac18frac23frac25frac34frac35frac38fr"
+			"ac45frac56frac58frac78fraslfrownfscrgEgElgacutegammagammadgapgbrevegcircgcygdotgegelgeqgeqqgeqsl"
+			"antgesgesccgesdotgesdotogesdotolgeslgeslesgfrggggggimelgjcyglglEglagljgnEgnapgnapproxgnegneqgneq"
+			"qgnsimgopfgravegscrgsimgsimegsimlgtgtccgtcirgtdotgtlPargtquestgtrapproxgtrarrgtrdotgtreqlessgtre"
+			"qqlessgtrlessgtrsimgvertneqqgvnEhArrhairsphalfhamilthardcyharrharrcirharrwhbarhcircheartsheartsu"
+			"ithellipherconhfrhksearowhkswarowhoarrhomththookleftarrowhookrightarrowhopfhorbarhscrhslashhstro"
+			"khybullhypheniacuteicicircicyiecyiexcliffifrigraveiiiiiintiiintiinfiniiotaijligimacrimageimaglin"
+			"eimagpartimathimofimpedinincareinfininfintieinodotintintcalintegersintercalintlarhkintprodiocyio"
+			"goniopfiotaiprodiquestiscrisinisinEisindotisinsisinsvisinvititildeiukcyiumljcircjcyjfrjmathjopfj"
+			"scrjsercyjukcykappakappavkcedilkcykfrkgreenkhcykjcykopfkscrlAarrlArrlAtaillBarrlElEglHarlacutela"
+			"emptyvlagranlambdalanglangdlanglelaplaquolarrlarrblarrbfslarrfslarrhklarrlplarrpllarrsimlarrtlla"
+			"tlataillatelateslbarrlbbrklbracelbracklbrkelbrksldlbrkslulcaronlcedillceillcublcyldcaldquoldquor"
+			"ldrdharldrusharldshleleftarrowleftarrowtailleftharpoondownleftharpoonupleftleftarrowsleftrightar"
+			"rowleftrightarrowsleftrightharpoonsleftrightsquigarrowleftthreetimeslegleqleqqleqslantleslesccle"
+			"sdotlesdotolesdotorlesglesgeslessapproxlessdotlesseqgtrlesseqqgtrlessgtrlesssimlfishtlfloorlfrlg"
+			"lgElhardlharulharullhblkljcyllllarrllcornerllhardlltrilmidotlmoustlmoustachelnElnaplnapproxlneln"
+			"eqlneqqlnsimloangloarrlobrklongleftarrowlongleftrightarrowlongmapstolongrightarrowlooparrowleftl"
+			"ooparrowrightloparlopflopluslotimeslowastlowbarlozlozengelozflparlparltlrarrlrcornerlrharlrhardl"
+			"rmlrtrilsaquolscrlshlsimlsimelsimglsqblsquolsquorlstrokltltccltcirltdotlthreeltimesltlarrltquest"
+			"ltrParltriltrieltriflurdsharluruharlvertneqqlvnEmDDotmacrmalemaltmaltesemapmapstomapstodownmapst"
+			"oleftmapstoupmarkermcommamcymdashmeasuredanglemfrmhomicromidmidastmidcirmiddotminusminusbminusdm"
+			"inusdumlcpmldrmnplusmodelsmopfmpmscrmstposmumultimapmumapnGgnGtnGtvnLeftarrownLeftrightarrownLln"
+			"LtnLtvnRightarrownVDashnVdashnablanacutenangnapnapEnapidnaposnapproxnaturnaturalnaturalsnbspnbum"
+			"pnbumpencapncaronncedilncongncongdotncupncyndashneneArrnearhknearrnearrownedotnequivnesearnesimn"
+			"existnexistsnfrngEngengeqngeqqngeqslantngesngsimngtngtrnhArrnharrnhparninisnisdnivnjcynlArrnlEnl"
+			"arrnldrnlenleftarrownleftrightarrownleqnleqqnleqslantnlesnlessnlsimnltnltrinltrienmidnopfnotnoti"
+			"nnotinEnotindotnotinvanotinvbnotinvcnotninotnivanotnivbnotnivcnparnparallelnparslnpartnpolintnpr"
+			"nprcuenprenprecnpreceqnrArrnrarrnrarrcnrarrwnrightarrownrtrinrtrienscnsccuenscenscrnshortmidnsho"
+			"rtparallelnsimnsimensimeqnsmidnsparnsqsubensqsupensubnsubEnsubensubsetnsubseteqnsubseteqqnsuccns"
+			"ucceqnsupnsupEnsupensupsetnsupseteqnsupseteqqntglntildentlgntriangleleftntrianglelefteqntriangle"
+			"rightntrianglerighteqnunumnumeronumspnvDashnvHarrnvapnvdashnvgenvgtnvinfinnvlArrnvlenvltnvltrien"
+			"vrArrnvrtrienvsimnwArrnwarhknwarrnwarrownwnearoSoacuteoastocirocircocyodashodblacodivodotodsoldo"
+			"eligofcirofrogonograveogtohbarohmointolarrolcirolcrossolineoltomacromegaomicronomidominusoopfopa"
+			"roperpoplusororarrordorderorderofordfordmorigoforororslopeorvoscroslashosolotildeotimesotimesaso"
+			"umlovbarparparaparallelparsimparslpartpcypercntperiodpermilperppertenkpfrphiphivphmmatphonepipit"
+			"chforkpivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdupluseplusmnplussimplustwopmpoint"
+			"intpopfpoundprprEprapprcuepreprecprecapproxpreccurlyeqpreceqprecnapproxprecneqqprecnsimprecsimpr"
+			"imeprimesprnEprnapprnsimprodprofalarproflineprofsurfpropproptoprsimprurelpscrpsipuncspqfrqintqop"
+			"fqprimeqscrquaternionsquatintquestquesteqquotrAarrrArrrAtailrBarrrHarraceracuteradicraemptyvrang"
+			"rangdrangerangleraquorarrrarraprarrbrarrbfsrarrcrarrfsrarrhkrarrlprarrplrarrsimrarrtlrarrwratail"
+			"ratiorationalsrbarrrbbrkrbracerbrackrbrkerbrksldrbrkslurcaronrcedilrceilrcubrcyrdcardldharrdquor"
+			"dquorrdshrealrealinerealpartrealsrectregrfishtrfloorrfrrhardrharurharulrhorhovrightarrowrightarr"
+			"owtailrightharpoondownrightharpoonuprightleftarrowsrightleftharpoonsrightrightarrowsrightsquigar"
+			"rowrightthreetimesringrisingdotseqrlarrrlharrlmrmoustrmoustachernmidroangroarrrobrkroparropfropl"
+			"usrotimesrparrpargtrppolintrrarrrsaquorscrrshrsqbrsquorsquorrthreertimesrtrirtriertrifrtriltriru"
+			"luharrxsacutesbquoscscEscapscaronsccuescescedilscircscnEscnapscnsimscpolintscsimscysdotsdotbsdot"
+			"eseArrsearhksearrsearrowsectsemiseswarsetminussetmnsextsfrsfrownsharpshchcyshcyshortmidshortpara"
+			"llelshysigmasigmafsigmavsimsimdotsimesimeqsimgsimgEsimlsimlEsimnesimplussimrarrslarrsmallsetminu"
+			"ssmashpsmeparslsmidsmilesmtsmtesmtessoftcysolsolbsolbarsopfspadesspadesuitsparsqcapsqcapssqcupsq"
+			"cupssqsubsqsubesqsubsetsqsubseteqsqsupsqsupesqsupsetsqsupseteqsqusquaresquarfsqufsrarrsscrssetmn"
+			"ssmilesstarfstarstarfstraightepsilonstraightphistrnssubsubEsubdotsubesubedotsubmultsubnEsubnesub"
+			"plussubrarrsubsetsubseteqsubseteqqsubsetneqsubsetneqqsubsimsubsubsubsupsuccsuccapproxsucccurlyeq"
+			"succeqsuccnapproxsuccneqqsuccnsimsuccsimsumsungsupsup1sup2sup3supEsupdotsupdsubsupesupedotsuphso"
+			"lsuphsubsuplarrsupmultsupnEsupnesupplussupsetsupseteqsupseteqqsupsetneqsupsetneqqsupsimsupsubsup"
+			"supswArrswarhkswarrswarrowswnwarszligtargettautbrktcarontcediltcytdottelrectfrthere4thereforethe"
+			"tathetasymthetavthickapproxthicksimthinspthkapthksimthorntildetimestimesbtimesbartimesdtinttoeat"
+			"optopbottopcirtopftopforktosatprimetradetriangletriangledowntrianglelefttrianglelefteqtriangleqt"
+			"rianglerighttrianglerighteqtridottrietriminustriplustrisbtritimetrpeziumtscrtscytshcytstroktwixt"
+			"twoheadleftarrowtwoheadrightarrowuArruHaruacuteuarrubrcyubreveucircucyudarrudblacudharufishtufru"
+			"graveuharluharruhblkulcornulcornerulcropultriumacrumluogonuopfuparrowupdownarrowupharpoonleftuph"
+			"arpoonrightuplusupsiupsihupsilonupuparrowsurcornurcornerurcropuringurtriuscrutdotutildeutriutrif"
+			"uuarruumluwanglevArrvBarvBarvvDashvangrtvarepsilonvarkappavarnothingvarphivarpivarproptovarrvarr"
+			"hovarsigmavarsubsetneqvarsubsetneqqvarsupsetneqvarsupsetneqqvarthetavartriangleleftvartriangleri"
+			"ghtvcyvdashveeveebarveeeqvellipverbarvertvfrvltrivnsubvnsupvopfvpropvrtrivscrvsubnEvsubnevsupnEv"
+			"supnevzigzagwcircwedbarwedgewedgeqweierpwfrwopfwpwrwreathwscrxcapxcircxcupxdtrixfrxhArrxharrxixl"
+			"ArrxlarrxmapxnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxuplusxutrixveexwedgeyacuteyacyycircycy"
+			"yenyfryicyyopfyscryucyyumlzacutezcaronzcyzdotzeetrfzetazfrzhcyzigrarrzopfzscrzwjzwnj";
+
+		inline constexpr entity entities[entity_count] =
+		{
+			{ 0, 5, 1, { 0x000C6, 0x00000 } },	// AElig
+			{ 5, 3, 1, { 0x00026, 0x00000 } },	// AMP
+			{ 8, 6, 1, { 0x000C1, 0x00000 } },	// Aacute
+			{ 14, 6, 1, { 0x00102, 0x00000 } },	// Abreve
+			{ 20, 5, 1, { 0x000C2, 0x00000 } },	// Acirc
+			{ 25, 3, 1, { 0x00410, 0x00000 } },	// Acy
+			{ 28, 3, 1, { 0x1D504, 0x00000 } },	// Afr
+			{ 31, 6, 1, { 0x000C0, 0x00000 } },	// Agrave
+			{ 37, 5, 1, { 0x00391, 0x00000 } },	// Alpha
+			{ 42, 5, 1, { 0x00100, 0x00000 } },	// Amacr
+			{ 47, 3, 1, { 0x02A53, 0x00000 } },	// And
+			{ 50, 5, 1, { 0x00104, 0x00000 } },	// Aogon
+			{ 55, 4, 1, { 0x1D538, 0x00000 } },	// Aopf
+			{ 59, 13, 1, { 0x02061, 0x00000 } },	// ApplyFunction
+			{ 72, 5, 1, { 0x000C5, 0x00000 } },	// Aring
+			{ 77, 4, 1, { 0x1D49C, 0x00000 } },	// Ascr
+			{ 81, 6, 1, { 0x02254, 0x00000 } },	// Assign
+			{ 87, 6, 1, { 0x000C3, 0x00000 } },	// Atilde
+			{ 93, 4, 1, { 0x000C4, 0x00000 } },	// Auml
+			{ 97, 9, 1, { 0x02216, 0x00000 } },	// Backslash
+			{ 106, 4, 1, { 0x02AE7, 0x00000 } },	// Barv
+			{ 110, 6, 1, { 0x02306, 0x00000 } },	// Barwed
+			{ 116, 3, 1, { 0x00411, 0x00000 } },	// Bcy
+			{ 119, 7, 1, { 0x02235, 0x00000 } },	// Because
+			{ 126, 10, 1, { 0x0212C, 0x00000 } },	// Bernoullis
+			{ 136, 4, 1, { 0x00392, 0x00000 } },	// Beta
+			{ 140, 3, 1, { 0x1D505, 0x00000 } },	// Bfr
+			{ 143, 4, 1, { 0x1D539, 0x00000 } },	// Bopf
+			{ 147, 5, 1, { 0x002D8, 0x00000 } },	// Breve
+			{ 152, 4, 1, { 0x0212C, 0x00000 } },	// Bscr
+			{ 156, 6, 1, { 0x0224E, 0x00000 } },	// Bumpeq
+			{ 162, 4, 1, { 0x00427, 0x00000 } },	// CHcy
+			{ 166, 4, 1, { 0x000A9, 0x00000 } },	// COPY
+			{ 170, 6, 1, { 0x00106, 0x00000 } },	// Cacute
+			{ 176, 3, 1, { 0x022D2, 0x00000 } },	// Cap
+			{ 179, 20, 1, { 0x02145, 0x00000 } },	// CapitalDifferentialD
+			{ 199, 7, 1, { 0x0212D, 0x00000 } },	// Cayleys
+			{ 206, 6, 1, { 0x0010C, 0x00000 } },	// Ccaron
+			{ 212, 6, 1, { 0x000C7, 0x00000 } },	// Ccedil
+			{ 218, 5, 1, { 0x00108, 0x00000 } },	// Ccirc
+			{ 223, 7, 1, { 0x02230, 0x00000 } },	// Cconint
+			{ 230, 4, 1, { 0x0010A, 0x00000 } },	// Cdot
+			{ 234, 7, 1, { 0x000B8, 0x00000 } },	// Cedilla
+			{ 241, 9, 1, { 0x000B7, 0x00000 } },	// CenterDot
+			{ 250, 3, 1, { 0x0212D, 0x00000 } },	// Cfr
+			{ 253, 3, 1, { 0x003A7, 0x00000 } },	// Chi
+			{ 256, 9, 1, { 0x02299, 0x00000 } },	// CircleDot
+			{ 265, 11, 1, { 0x02296, 0x00000 } },	// CircleMinus
+			{ 276, 10, 1, { 0x02295, 0x00000 } },	// CirclePlus
+			{ 286, 11, 1, { 0x02297, 0x00000 } },	// CircleTimes
+			{ 297, 24, 1, { 0x02232, 0x00000 } },	// ClockwiseContourIntegral
+			{ 321, 21, 1, { 0x0201D, 0x00000 } },	// CloseCurlyDoubleQuote
+			{ 342, 15, 1, { 0x02019, 0x00000 } },	// CloseCurlyQuote
+			{ 357, 5, 1, { 0x02237, 0x00000 } },	// Colon
+			{ 362, 6, 1, { 0x02A74, 0x00000 } },	// Colone
+			{ 368, 9, 1, { 0x02261, 0x00000 } },	// Congruent
+			{ 377, 6, 1, { 0x0222F, 0x00000 } },	// Conint
+			{ 383, 15, 1, { 0x0222E, 0x00000 } },	// ContourIntegral
+			{ 398, 4, 1, { 0x02102, 0x00000 } },	// Copf
+			{ 402, 9, 1, { 0x02210, 0x00000 } },	// Coproduct
+			{ 411, 31, 1, { 0x02233, 0x00000 } },	// CounterClockwiseContourIntegral
+			{ 442, 5, 1, { 0x02A2F, 0x00000 } },	// Cross
+			{ 447, 4, 1, { 0x1D49E, 0x00000 } },	// Cscr
+			{ 451, 3, 1, { 0x022D3, 0x00000 } },	// Cup
+			{ 454, 6, 1, { 0x0224D, 0x00000 } },	// CupCap
+			{ 460, 2, 1, { 0x02145, 0x00000 } },	// DD
+			{ 462, 8, 1, { 0x02911, 0x00000 } },	// DDotrahd
+			{ 470, 4, 1, { 0x00402, 0x00000 } },	// DJcy
+			{ 474, 4, 1, { 0x00405, 0x00000 } },	// DScy
+			{ 478, 4, 1, { 0x0040F, 0x00000 } },	// DZcy
+			{ 482, 6, 1, { 0x02021, 0x00000 } },	// Dagger
+			{ 488, 4, 1, { 0x021A1, 0x00000 } },	// Darr
+			{ 492, 5, 1, { 0x02AE4, 0x00000 } },	// Dashv
+			{ 497, 6, 1, { 0x0010E, 0x00000 } },	// Dcaron
+			{ 503, 3, 1, { 0x00414, 0x00000 } },	// Dcy
+			{ 506, 3, 1, { 0x02207, 0x00000 } },	// Del
+			{ 509, 5, 1, { 0x00394, 0x00000 } },	// Delta
+			{ 514, 3, 1, { 0x1D507, 0x00000 } },	// Dfr
+			{ 517, 16, 1, { 0x000B4, 0x00000 } },	// DiacriticalAcute
+			{ 533, 14, 1, { 0x002D9, 0x00000 } },	// DiacriticalDot
+			{ 547, 22, 1, { 0x002DD, 0x00000 } },	// DiacriticalDoubleAcute
+			{ 569, 16, 1, { 0x00060, 0x00000 } },	// DiacriticalGrave
+			{ 585, 16, 1, { 0x002DC, 0x00000 } },	// DiacriticalTilde
+			{ 601, 7, 1, { 0x022C4, 0x00000 } },	// Diamond
+			{ 608, 13, 1, { 0x02146, 0x00000 } },	// DifferentialD
+			{ 621, 4, 1, { 0x1D53B, 0x00000 } },	// Dopf
+			{ 625, 3, 1, { 0x000A8, 0x00000 } },	// Dot
+			{ 628, 6, 1, { 0x020DC, 0x00000 } },	// DotDot
+			{ 634, 8, 1, { 0x02250, 0x00000 } },	// DotEqual
+			{ 642, 21, 1, { 0x0222F, 0x00000 } },	// DoubleContourIntegral
+			{ 663, 9, 1, { 0x000A8, 0x00000 } },	// DoubleDot
+			{ 672, 15, 1, { 0x021D3, 0x00000 } },	// DoubleDownArrow
+			{ 687, 15, 1, { 0x021D0, 0x00000 } },	// DoubleLeftArrow
+			{ 702, 20, 1, { 0x021D4, 0x00000 } },	// DoubleLeftRightArrow
+			{ 722, 13, 1, { 0x02AE4, 0x00000 } },	// DoubleLeftTee
+			{ 735, 19, 1, { 0x027F8, 0x00000 } },	// DoubleLongLeftArrow
+			{ 754, 24, 1, { 0x027FA, 0x00000 } },	// DoubleLongLeftRightArrow
+			{ 778, 20, 1, { 0x027F9, 0x00000 } },	// DoubleLongRightArrow
+			{ 798, 16, 1, { 0x021D2, 0x00000 } },	// DoubleRightArrow
+			{ 814, 14, 1, { 0x022A8, 0x00000 } },	// DoubleRightTee
+			{ 828, 13, 1, { 0x021D1, 0x00000 } },	// DoubleUpArrow
+			{ 841, 17, 1, { 0x021D5, 0x00000 } },	// DoubleUpDownArrow
+			{ 858, 17, 1, { 0x02225, 0x00000 } },	// DoubleVerticalBar
+			{ 875, 9, 1, { 0x02193, 0x00000 } },	// DownArrow
+			{ 884, 12, 1, { 0x02913, 0x00000 } },	// DownArrowBar
+			{ 896, 16, 1, { 0x021F5, 0x00000 } },	// DownArrowUpArrow
+			{ 912, 9, 1, { 0x00311, 0x00000 } },	// DownBreve
+			{ 921, 19, 1, { 0x02950, 0x00000 } },	// DownLeftRightVector
+			{ 940, 17, 1, { 0x0295E, 0x00000 } },	// DownLeftTeeVector
+			{ 957, 14, 1, { 0x021BD, 0x00000 } },	// DownLeftVector
+			{ 971, 17, 1, { 0x02956, 0x00000 } },	// DownLeftVectorBar
+			{ 988, 18, 1, { 0x0295F, 0x00000 } },	// DownRightTeeVector
+			{ 1006, 15, 1, { 0x021C1, 0x00000 } },	// DownRightVector
+			{ 1021, 18, 1, { 0x02957, 0x00000 } },	// DownRightVectorBar
+			{ 1039, 7, 1, { 0x022A4, 0x00000 } },	// DownTee
+			{ 1046, 12, 1, { 0x021A7, 0x00000 } },	// DownTeeArrow
+			{ 1058, 9, 1, { 0x021D3, 0x00000 } },	// Downarrow
+			{ 1067, 4, 1, { 0x1D49F, 0x00000 } },	// Dscr
+			{ 1071, 6, 1, { 0x00110, 0x00000 } },	// Dstrok
+			{ 1077, 3, 1, { 0x0014A, 0x00000 } },	// ENG
+			{ 1080, 3, 1, { 0x000D0, 0x00000 } },	// ETH
+			{ 1083, 6, 1, { 0x000C9, 0x00000 } },	// Eacute
+			{ 1089, 6, 1, { 0x0011A, 0x00000 } },	// Ecaron
+			{ 1095, 5, 1, { 0x000CA, 0x00000 } },	// Ecirc
+			{ 1100, 3, 1, { 0x0042D, 0x00000 } },	// Ecy
+			{ 1103, 4, 1, { 0x00116, 0x00000 } },	// Edot
+			{ 1107, 3, 1, { 0x1D508, 0x00000 } },	// Efr
+			{ 1110, 6, 1, { 0x000C8, 0x00000 } },	// Egrave
+			{ 1116, 7, 1, { 0x02208, 0x00000 } },	// Element
+			{ 1123, 5, 1, { 0x00112, 0x00000 } },	// Emacr
+			{ 1128, 16, 1, { 0x025FB, 0x00000 } },	// EmptySmallSquare
+			{ 1144, 20, 1, { 0x025AB, 0x00000 } },	// EmptyVerySmallSquare
+			{ 1164, 5, 1, { 0x00118, 0x00000 } },	// Eogon
+			{ 1169, 4, 1, { 0x1D53C, 0x00000 } },	// Eopf
+			{ 1173, 7, 1, { 0x00395, 0x00000 } },	// Epsilon
+			{ 1180, 5, 1, { 0x02A75, 0x00000 } },	// Equal
+			{ 1185, 10, 1, { 0x02242, 0x00000 } },	// EqualTilde
+			{ 1195, 11, 1, { 0x021CC, 0x00000 } },	// Equilibrium
+			{ 1206, 4, 1, { 0x02130, 0x00000 } },	// Escr
+			{ 1210, 4, 1, { 0x02A73, 0x00000 } },	// Esim
+			{ 1214, 3, 1, { 0x00397, 0x00000 } },	// Eta
+			{ 1217, 4, 1, { 0x000CB, 0x00000 } },	// Euml
+			{ 1221, 6, 1, { 0x02203, 0x00000 } },	// Exists
+			{ 1227, 12, 1, { 0x02147, 0x00000 } },	// ExponentialE
+			{ 1239, 3, 1, { 0x00424, 0x00000 } },	// Fcy
+			{ 1242, 3, 1, { 0x1D509, 0x00000 } },	// Ffr
+			{ 1245, 17, 1, { 0x025FC, 0x00000 } },	// FilledSmallSquare
+			{ 1262, 21, 1, { 0x025AA, 0x00000 } },	// FilledVerySmallSquare
+			{ 1283, 4, 1, { 0x1D53D, 0x00000 } },	// Fopf
+			{ 1287, 6, 1, { 0x02200, 0x00000 } },	// ForAll
+			{ 1293, 10, 1, { 0x02131, 0x00000 } },	// Fouriertrf
+			{ 1303, 4, 1, { 0x02131, 0x00000 } },	// Fscr
+			{ 1307, 4, 1, { 0x00403, 0x00000 } },	// GJcy
+			{ 1311, 2, 1, { 0x0003E, 0x00000 } },	// GT
+			{ 1313, 5, 1, { 0x00393, 0x00000 } },	// Gamma
+			{ 1318, 6, 1, { 0x003DC, 0x00000 } },	// Gammad
+			{ 1324, 6, 1, { 0x0011E, 0x00000 } },	// Gbreve
+			{ 1330, 6, 1, { 0x00122, 0x00000 } },	// Gcedil
+			{ 1336, 5, 1, { 0x0011C, 0x00000 } },	// Gcirc
+			{ 1341, 3, 1, { 0x00413, 0x00000 } },	// Gcy
+			{ 1344, 4, 1, { 0x00120, 0x00000 } },	// Gdot
+			{ 1348, 3, 1, { 0x1D50A, 0x00000 } },	// Gfr
+			{ 1351, 2, 1, { 0x022D9, 0x00000 } },	// Gg
+			{ 1353, 4, 1, { 0x1D53E, 0x00000 } },	// Gopf
+			{ 1357, 12, 1, { 0x02265, 0x00000 } },	// GreaterEqual
+			{ 1369, 16, 1, { 0x022DB, 0x00000 } },	// GreaterEqualLess
+			{ 1385, 16, 1, { 0x02267, 0x00000 } },	// GreaterFullEqual
+			{ 1401, 14, 1, { 0x02AA2, 0x00000 } },	// GreaterGreater
+			{ 1415, 11, 1, { 0x02277, 0x00000 } },	// GreaterLess
+			{ 1426, 17, 1, { 0x02A7E, 0x00000 } },	// GreaterSlantEqual
+			{ 1443, 12, 1, { 0x02273, 0x00000 } },	// GreaterTilde
+			{ 1455, 4, 1, { 0x1D4A2, 0x00000 } },	// Gscr
+			{ 1459, 2, 1, { 0x0226B, 0x00000 } },	// Gt
+			{ 1461, 6, 1, { 0x0042A, 0x00000 } },	// HARDcy
+			{ 1467, 5, 1, { 0x002C7, 0x00000 } },	// Hacek
+			{ 1472, 3, 1, { 0x0005E, 0x00000 } },	// Hat
+			{ 1475, 5, 1, { 0x00124, 0x00000 } },	// Hcirc
+			{ 1480, 3, 1, { 0x0210C, 0x00000 } },	// Hfr
+			{ 1483, 12, 1, { 0x0210B, 0x00000 } },	// HilbertSpace
+			{ 1495, 4, 1, { 0x0210D, 0x00000 } },	// Hopf
+			{ 1499, 14, 1, { 0x02500, 0x00000 } },	// HorizontalLine
+			{ 1513, 4, 1, { 0x0210B, 0x00000 } },	// Hscr
+			{ 1517, 6, 1, { 0x00126, 0x00000 } },	// Hstrok
+			{ 1523, 12, 1, { 0x0224E, 0x00000 } },	// HumpDownHump
+			{ 1535, 9, 1, { 0x0224F, 0x00000 } },	// HumpEqual
+			{ 1544, 4, 1, { 0x00415, 0x00000 } },	// IEcy
+			{ 1548, 5, 1, { 0x00132, 0x00000 } },	// IJlig
+			{ 1553, 4, 1, { 0x00401, 0x00000 } },	// IOcy
+			{ 1557, 6, 1, { 0x000CD, 0x00000 } },	// Iacute
+			{ 1563, 5, 1, { 0x000CE, 0x00000 } },	// Icirc
+			{ 1568, 3, 1, { 0x00418, 0x00000 } },	// Icy
+			{ 1571, 4, 1, { 0x00130, 0x00000 } },	// Idot
+			{ 1575, 3, 1, { 0x02111, 0x00000 } },	// Ifr
+			{ 1578, 6, 1, { 0x000CC, 0x00000 } },	// Igrave
+			{ 1584, 2, 1, { 0x02111, 0x00000 } },	// Im
+			{ 1586, 5, 1, { 0x0012A, 0x00000 } },	// Imacr
+			{ 1591, 10, 1, { 0x02148, 0x00000 } },	// ImaginaryI
+			{ 1601, 7, 1, { 0x021D2, 0x00000 } },	// Implies
+			{ 1608, 3, 1, { 0x0222C, 0x00000 } },	// Int
+			{ 1611, 8, 1, { 0x0222B, 0x00000 } },	// Integral
+			{ 1619, 12, 1, { 0x022C2, 0x00000 } },	// Intersection
+			{ 1631, 14, 1, { 0x02063, 0x00000 } },	// InvisibleComma
+			{ 1645, 14, 1, { 0x02062, 0x00000 } },	// InvisibleTimes
+			{ 1659, 5, 1, { 0x0012E, 0x00000 } },	// Iogon
+			{ 1664, 4, 1, { 0x1D540, 0x00000 } },	// Iopf
+			{ 1668, 4, 1, { 0x00399, 0x00000 } },	// Iota
+			{ 1672, 4, 1, { 0x02110, 0x00000 } },	// Iscr
+			{ 1676, 6, 1, { 0x00128, 0x00000 } },	// Itilde
+			{ 1682, 5, 1, { 0x00406, 0x00000 } },	// Iukcy
+			{ 1687, 4, 1, { 0x000CF, 0x00000 } },	// Iuml
+			{ 1691, 5, 1, { 0x00134, 0x00000 } },	// Jcirc
+			{ 1696, 3, 1, { 0x00419, 0x00000 } },	// Jcy
+			{ 1699, 3, 1, { 0x1D50D, 0x00000 } },	// Jfr
+			{ 1702, 4, 1, { 0x1D541, 0x00000 } },	// Jopf
+			{ 1706, 4, 1, { 0x1D4A5, 0x00000 } },	// Jscr
+			{ 1710, 6, 1, { 0x00408, 0x00000 } },	// Jsercy
+			{ 1716, 5, 1, { 0x00404, 0x00000 } },	// Jukcy
+			{ 1721, 4, 1, { 0x00425, 0x00000 } },	// KHcy
+			{ 1725, 4, 1, { 0x0040C, 0x00000 } },	// KJcy
+			{ 1729, 5, 1, { 0x0039A, 0x00000 } },	// Kappa
+			{ 1734, 6, 1, { 0x00136, 0x00000 } },	// Kcedil
+			{ 1740, 3, 1, { 0x0041A, 0x00000 } },	// Kcy
+			{ 1743, 3, 1, { 0x1D50E, 0x00000 } },	// Kfr
+			{ 1746, 4, 1, { 0x1D542, 0x00000 } },	// Kopf
+			{ 1750, 4, 1, { 0x1D4A6, 0x00000 } },	// Kscr
+			{ 1754, 4, 1, { 0x00409, 0x00000 } },	// LJcy
+			{ 1758, 2, 1, { 0x0003C, 0x00000 } },	// LT
+			{ 1760, 6, 1, { 0x00139, 0x00000 } },	// Lacute
+			{ 1766, 6, 1, { 0x0039B, 0x00000 } },	// Lambda
+			{ 1772, 4, 1, { 0x027EA, 0x00000 } },	// Lang
+			{ 1776, 10, 1, { 0x02112, 0x00000 } },	// Laplacetrf
+			{ 1786, 4, 1, { 0x0219E, 0x00000 } },	// Larr
+			{ 1790, 6, 1, { 0x0013D, 0x00000 } },	// Lcaron
+			{ 1796, 6, 1, { 0x0013B, 0x00000 } },	// Lcedil
+			{ 1802, 3, 1, { 0x0041B, 0x00000 } },	// Lcy
+			{ 1805, 16, 1, { 0x027E8, 0x00000 } },	// LeftAngleBracket
+			{ 1821, 9, 1, { 0x02190, 0x00000 } },	// LeftArrow
+			{ 1830, 12, 1, { 0x021E4, 0x00000 } },	// LeftArrowBar
+			{ 1842, 19, 1, { 0x021C6, 0x00000 } },	// LeftArrowRightArrow
+			{ 1861, 11, 1, { 0x02308, 0x00000 } },	// LeftCeiling
+			{ 1872, 17, 1, { 0x027E6, 0x00000 } },	// LeftDoubleBracket
+			{ 1889, 17, 1, { 0x02961, 0x00000 } },	// LeftDownTeeVector
+			{ 1906, 14, 1, { 0x021C3, 0x00000 } },	// LeftDownVector
+			{ 1920, 17, 1, { 0x02959, 0x00000 } },	// LeftDownVectorBar
+			{ 1937, 9, 1, { 0x0230A, 0x00000 } },	// LeftFloor
+			{ 1946, 14, 1, { 0x02194, 0x00000 } },	// LeftRightArrow
+			{ 1960, 15, 1, { 0x0294E, 0x00000 } },	// LeftRightVector
+			{ 1975, 7, 1, { 0x022A3, 0x00000 } },	// LeftTee
+			{ 1982, 12, 1, { 0x021A4, 0x00000 } },	// LeftTeeArrow
+			{ 1994, 13, 1, { 0x0295A, 0x00000 } },	// LeftTeeVector
+			{ 2007, 12, 1, { 0x022B2, 0x00000 } },	// LeftTriangle
+			{ 2019, 15, 1, { 0x029CF, 0x00000 } },	// LeftTriangleBar
+			{ 2034, 17, 1, { 0x022B4, 0x00000 } },	// LeftTriangleEqual
+			{ 2051, 16, 1, { 0x02951, 0x00000 } },	// LeftUpDownVector
+			{ 2067, 15, 1, { 0x02960, 0x00000 } },	// LeftUpTeeVector
+			{ 2082, 12, 1, { 0x021BF, 0x00000 } },	// LeftUpVector
+			{ 2094, 15, 1, { 0x02958, 0x00000 } },	// LeftUpVectorBar
+			{ 2109, 10, 1, { 0x021BC, 0x00000 } },	// LeftVector
+			{ 2119, 13, 1, { 0x02952, 0x00000 } },	// LeftVectorBar
+			{ 2132, 9, 1, { 0x021D0, 0x00000 } },	// Leftarrow
+			{ 2141, 14, 1, { 0x021D4, 0x00000 } },	// Leftrightarrow
+			{ 2155, 16, 1, { 0x022DA, 0x00000 } },	// LessEqualGreater
+			{ 2171, 13, 1, { 0x02266, 0x00000 } },	// LessFullEqual
+			{ 2184, 11, 1, { 0x02276, 0x00000 } },	// LessGreater
+			{ 2195, 8, 1, { 0x02AA1, 0x00000 } },	// LessLess
+			{ 2203, 14, 1, { 0x02A7D, 0x00000 } },	// LessSlantEqual
+			{ 2217, 9, 1, { 0x02272, 0x00000 } },	// LessTilde
+			{ 2226, 3, 1, { 0x1D50F, 0x00000 } },	// Lfr
+			{ 2229, 2, 1, { 0x022D8, 0x00000 } },	// Ll
+			{ 2231, 10, 1, { 0x021DA, 0x00000 } },	// Lleftarrow
+			{ 2241, 6, 1, { 0x0013F, 0x00000 } },	// Lmidot
+			{ 2247, 13, 1, { 0x027F5, 0x00000 } },	// LongLeftArrow
+			{ 2260, 18, 1, { 0x027F7, 0x00000 } },	// LongLeftRightArrow
+			{ 2278, 14, 1, { 0x027F6, 0x00000 } },	// LongRightArrow
+			{ 2292, 13, 1, { 0x027F8, 0x00000 } },	// Longleftarrow
+			{ 2305, 18, 1, { 0x027FA, 0x00000 } },	// Longleftrightarrow
+			{ 2323, 14, 1, { 0x027F9, 0x00000 } },	// Longrightarrow
+			{ 2337, 4, 1, { 0x1D543, 0x00000 } },	// Lopf
+			{ 2341, 14, 1, { 0x02199, 0x00000 } },	// LowerLeftArrow
+			{ 2355, 15, 1, { 0x02198, 0x00000 } },	// LowerRightArrow
+			{ 2370, 4, 1, { 0x02112, 0x00000 } },	// Lscr
+			{ 2374, 3, 1, { 0x021B0, 0x00000 } },	// Lsh
+			{ 2377, 6, 1, { 0x00141, 0x00000 } },	// Lstrok
+			{ 2383, 2, 1, { 0x0226A, 0x00000 } },	// Lt
+			{ 2385, 3, 1, { 0x02905, 0x00000 } },	// Map
+			{ 2388, 3, 1, { 0x0041C, 0x00000 } },	// Mcy
+			{ 2391, 11, 1, { 0x0205F, 0x00000 } },	// MediumSpace
+			{ 2402, 9, 1, { 0x02133, 0x00000 } },	// Mellintrf
+			{ 2411, 3, 1, { 0x1D510, 0x00000 } },	// Mfr
+			{ 2414, 9, 1, { 0x02213, 0x00000 } },	// MinusPlus
+			{ 2423, 4, 1, { 0x1D544, 0x00000 } },	// Mopf
+			{ 2427, 4, 1, { 0x02133, 0x00000 } },	// Mscr
+			{ 2431, 2, 1, { 0x0039C, 0x00000 } },	// Mu
+			{ 2433, 4, 1, { 0x0040A, 0x00000 } },	// NJcy
+			{ 2437, 6, 1, { 0x00143, 0x00000 } },	// Nacute
+			{ 2443, 6, 1, { 0x00147, 0x00000 } },	// Ncaron
+			{ 2449, 6, 1, { 0x00145, 0x00000 } },	// Ncedil
+			{ 2455, 3, 1, { 0x0041D, 0x00000 } },	// Ncy
+			{ 2458, 19, 1, { 0x0200B, 0x00000 } },	// NegativeMediumSpace
+			{ 2477, 18, 1, { 0x0200B, 0x00000 } },	// NegativeThickSpace
+			{ 2495, 17, 1, { 0x0200B, 0x00000 } },	// NegativeThinSpace
+			{ 2512, 21, 1, { 0x0200B, 0x00000 } },	// NegativeVeryThinSpace
+			{ 2533, 20, 1, { 0x0226B, 0x00000 } },	// NestedGreaterGreater
+			{ 2553, 14, 1, { 0x0226A, 0x00000 } },	// NestedLessLess
+			{ 2567, 7, 1, { 0x0000A, 0x00000 } },	// NewLine
+			{ 2574, 3, 1, { 0x1D511, 0x00000 } },	// Nfr
+			{ 2577, 7, 1, { 0x02060, 0x00000 } },	// NoBreak
+			{ 2584, 16, 1, { 0x000A0, 0x00000 } },	// NonBreakingSpace
+			{ 2600, 4, 1, { 0x02115, 0x00000 } },	// Nopf
+			{ 2604, 3, 1, { 0x02AEC, 0x00000 } },	// Not
+			{ 2607, 12, 1, { 0x02262, 0x00000 } },	// NotCongruent
+			{ 2619, 9, 1, { 0x0226D, 0x00000 } },	// NotCupCap
+			{ 2628, 20, 1, { 0x02226, 0x00000 } },	// NotDoubleVerticalBar
+			{ 2648, 10, 1, { 0x02209, 0x00000 } },	// NotElement
+			{ 2658, 8, 1, { 0x02260, 0x00000 } },	// NotEqual
+			{ 2666, 13, 2, { 0x02242, 0x00338 } },	// NotEqualTilde
+			{ 2679, 9, 1, { 0x02204, 0x00000 } },	// NotExists
+			{ 2688, 10, 1, { 0x0226F, 0x00000 } },	// NotGreater
+			{ 2698, 15, 1, { 0x02271, 0x00000 } },	// NotGreaterEqual
+			{ 2713, 19, 2, { 0x02267, 0x00338 } },	// NotGreaterFullEqual
+			{ 2732, 17, 2, { 0x0226B, 0x00338 } },	// NotGreaterGreater
+			{ 2749, 14, 1, { 0x02279, 0x00000 } },	// NotGreaterLess
+			{ 2763, 20, 2, { 0x02A7E, 0x00338 } },	// NotGreaterSlantEqual
+			{ 2783, 15, 1, { 0x02275, 0x00000 } },	// NotGreaterTilde
+			{ 2798, 15, 2, { 0x0224E, 0x00338 } },	// NotHumpDownHump
+			{ 2813, 12, 2, { 0x0224F, 0x00338 } },	// NotHumpEqual
+			{ 2825, 15, 1, { 0x022EA, 0x00000 } },	// NotLeftTriangle
+			{ 2840, 18, 2, { 0x029CF, 0x00338 } },	// NotLeftTriangleBar
+			{ 2858, 20, 1, { 0x022EC, 0x00000 } },	// NotLeftTriangleEqual
+			{ 2878, 7, 1, { 0x0226E, 0x00000 } },	// NotLess
+			{ 2885, 12, 1, { 0x02270, 0x00000 } },	// NotLessEqual
+			{ 2897, 14, 1, { 0x02278, 0x00000 } },	// NotLessGreater
+			{ 2911, 11, 2, { 0x0226A, 0x00338 } },	// NotLessLess
+			{ 2922, 17, 2, { 0x02A7D, 0x00338 } },	// NotLessSlantEqual
+			{ 2939, 12, 1, { 0x02274, 0x00000 } },	// NotLessTilde
+			{ 2951, 23, 2, { 0x02AA2, 0x00338 } },	// NotNestedGreaterGreater
+			{ 2974, 17, 2, { 0x02AA1, 0x00338 } },	// NotNestedLessLess
+			{ 2991, 11, 1, { 0x02280, 0x00000 } },	// NotPrecedes
+			{ 3002, 16, 2, { 0x02AAF, 0x00338 } },	// NotPrecedesEqual
+			{ 3018, 21, 1, { 0x022E0, 0x00000 } },	// NotPrecedesSlantEqual
+			{ 3039, 17, 1, { 0x0220C, 0x00000 } },	// NotReverseElement
+			{ 3056, 16, 1, { 0x022EB, 0x00000 } },	// NotRightTriangle
+			{ 3072, 19, 2, { 0x029D0, 0x00338 } },	// NotRightTriangleBar
+			{ 3091, 21, 1, { 0x022ED, 0x00000 } },	// NotRightTriangleEqual
+			{ 3112, 15, 2, { 0x0228F, 0x00338 } },	// NotSquareSubset
+			{ 3127, 20, 1, { 0x022E2, 0x00000 } },	// NotSquareSubsetEqual
+			{ 3147, 17, 2, { 0x02290, 0x00338 } },	// NotSquareSuperset
+			{ 3164, 22, 1, { 0x022E3, 0x00000 } },	// NotSquareSupersetEqual
+			{ 3186, 9, 2, { 0x02282, 0x020D2 } },	// NotSubset
+			{ 3195, 14, 1, { 0x02288, 0x00000 } },	// NotSubsetEqual
+			{ 3209, 11, 1, { 0x02281, 0x00000 } },	// NotSucceeds
+			{ 3220, 16, 2, { 0x02AB0, 0x00338 } },	// NotSucceedsEqual
+			{ 3236, 21, 1, { 0x022E1, 0x00000 } },	// NotSucceedsSlantEqual
+			{ 3257, 16, 2, { 0x0227F, 0x00338 } },	// NotSucceedsTilde
+			{ 3273, 11, 2, { 0x02283, 0x020D2 } },	// NotSuperset
+			{ 3284, 16, 1, { 0x02289, 0x00000 } },	// NotSupersetEqual
+			{ 3300, 8, 1, { 0x02241, 0x00000 } },	// NotTilde
+			{ 3308, 13, 1, { 0x02244, 0x00000 } },	// NotTildeEqual
+			{ 3321, 17, 1, { 0x02247, 0x00000 } },	// NotTildeFullEqual
+			{ 3338, 13, 1, { 0x02249, 0x00000 } },	// NotTildeTilde
+			{ 3351, 14, 1, { 0x02224, 0x00000 } },	// NotVerticalBar
+			{ 3365, 4, 1, { 0x1D4A9, 0x00000 } },	// Nscr
+			{ 3369, 6, 1, { 0x000D1, 0x00000 } },	// Ntilde
+			{ 3375, 2, 1, { 0x0039D, 0x00000 } },	// Nu
+			{ 3377, 5, 1, { 0x00152, 0x00000 } },	// OElig
+			{ 3382, 6, 1, { 0x000D3, 0x00000 } },	// Oacute
+			{ 3388, 5, 1, { 0x000D4, 0x00000 } },	// Ocirc
+			{ 3393, 3, 1, { 0x0041E, 0x00000 } },	// Ocy
+			{ 3396, 6, 1, { 0x00150, 0x00000 } },	// Odblac
+			{ 3402, 3, 1, { 0x1D512, 0x00000 } },	// Ofr
+			{ 3405, 6, 1, { 0x000D2, 0x00000 } },	// Ograve
+			{ 3411, 5, 1, { 0x0014C, 0x00000 } },	// Omacr
+			{ 3416, 5, 1, { 0x003A9, 0x00000 } },	// Omega
+			{ 3421, 7, 1, { 0x0039F, 0x00000 } },	// Omicron
+			{ 3428, 4, 1, { 0x1D546, 0x00000 } },	// Oopf
+			{ 3432, 20, 1, { 0x0201C, 0x00000 } },	// OpenCurlyDoubleQuote
+			{ 3452, 14, 1, { 0x02018, 0x00000 } },	// OpenCurlyQuote
+			{ 3466, 2, 1, { 0x02A54, 0x00000 } },	// Or
+			{ 3468, 4, 1, { 0x1D4AA, 0x00000 } },	// Oscr
+			{ 3472, 6, 1, { 0x000D8, 0x00000 } },	// Oslash
+			{ 3478, 6, 1, { 0x000D5, 0x00000 } },	// Otilde
+			{ 3484, 6, 1, { 0x02A37, 0x00000 } },	// Otimes
+			{ 3490, 4, 1, { 0x000D6, 0x00000 } },	// Ouml
+			{ 3494, 7, 1, { 0x0203E, 0x00000 } },	// OverBar
+			{ 3501, 9, 1, { 0x023DE, 0x00000 } },	// OverBrace
+			{ 3510, 11, 1, { 0x023B4, 0x00000 } },	// OverBracket
+			{ 3521, 15, 1, { 0x023DC, 0x00000 } },	// OverParenthesis
+			{ 3536, 8, 1, { 0x02202, 0x00000 } },	// PartialD
+			{ 3544, 3, 1, { 0x0041F, 0x00000 } },	// Pcy
+			{ 3547, 3, 1, { 0x1D513, 0x00000 } },	// Pfr
+			{ 3550, 3, 1, { 0x003A6, 0x00000 } },	// Phi
+			{ 3553, 2, 1, { 0x003A0, 0x00000 } },	// Pi
+			{ 3555, 9, 1, { 0x000B1, 0x00000 } },	// PlusMinus
+			{ 3564, 13, 1, { 0x0210C, 0x00000 } },	// Poincareplane
+			{ 3577, 4, 1, { 0x02119, 0x00000 } },	// Popf
+			{ 3581, 2, 1, { 0x02ABB, 0x00000 } },	// Pr
+			{ 3583, 8, 1, { 0x0227A, 0x00000 } },	// Precedes
+			{ 3591, 13, 1, { 0x02AAF, 0x00000 } },	// PrecedesEqual
+			{ 3604, 18, 1, { 0x0227C, 0x00000 } },	// PrecedesSlantEqual
+			{ 3622, 13, 1, { 0x0227E, 0x00000 } },	// PrecedesTilde
+			{ 3635, 5, 1, { 0x02033, 0x00000 } },	// Prime
+			{ 3640, 7, 1, { 0x0220F, 0x00000 } },	// Product
+			{ 3647, 10, 1, { 0x02237, 0x00000 } },	// Proportion
+			{ 3657, 12, 1, { 0x0221D, 0x00000 } },	// Proportional
+			{ 3669, 4, 1, { 0x1D4AB, 0x00000 } },	// Pscr
+			{ 3673, 3, 1, { 0x003A8, 0x00000 } },	// Psi
+			{ 3676, 4, 1, { 0x00022, 0x00000 } },	// QUOT
+			{ 3680, 3, 1, { 0x1D514, 0x00000 } },	// Qfr
+			{ 3683, 4, 1, { 0x0211A, 0x00000 } },	// Qopf
+			{ 3687, 4, 1, { 0x1D4AC, 0x00000 } },	// Qscr
+			{ 3691, 5, 1, { 0x02910, 0x00000 } },	// RBarr
+			{ 3696, 3, 1, { 0x000AE, 0x00000 } },	// REG
+			{ 3699, 6, 1, { 0x00154, 0x00000 } },	// Racute
+			{ 3705, 4, 1, { 0x027EB, 0x00000 } },	// Rang
+			{ 3709, 4, 1, { 0x021A0, 0x00000 } },	// Rarr
+			{ 3713, 6, 1, { 0x02916, 0x00000 } },	// Rarrtl
+			{ 3719, 6, 1, { 0x00158, 0x00000 } },	// Rcaron
+			{ 3725, 6, 1, { 0x00156, 0x00000 } },	// Rcedil
+			{ 3731, 3, 1, { 0x00420, 0x00000 } },	// Rcy
+			{ 3734, 2, 1, { 0x0211C, 0x00000 } },	// Re
+			{ 3736, 14, 1, { 0x0220B, 0x00000 } },	// ReverseElement
+			{ 3750, 18, 1, { 0x021CB, 0x00000 } },	// ReverseEquilibrium
+			{ 3768, 20, 1, { 0x0296F, 0x00000 } },	// ReverseUpEquilibrium
+			{ 3788, 3, 1, { 0x0211C, 0x00000 } },	// Rfr
+			{ 3791, 3, 1, { 0x003A1, 0x00000 } },	// Rho
+			{ 3794, 17, 1, { 0x027E9, 0x00000 } },	// RightAngleBracket
+			{ 3811, 10, 1, { 0x02192, 0x00000 } },	// RightArrow
+			{ 3821, 13, 1, { 0x021E5, 0x00000 } },	// RightArrowBar
+			{ 3834, 19, 1, { 0x021C4, 0x00000 } },	// RightArrowLeftArrow
+			{ 3853, 12, 1, { 0x02309, 0x00000 } },	// RightCeiling
+			{ 3865, 18, 1, { 0x027E7, 0x00000 } },	// RightDoubleBracket
+			{ 3883, 18, 1, { 0x0295D, 0x00000 } },	// RightDownTeeVector
+			{ 3901, 15, 1, { 0x021C2, 0x00000 } },	// RightDownVector
+			{ 3916, 18, 1, { 0x02955, 0x00000 } },	// RightDownVectorBar
+			{ 3934, 10, 1, { 0x0230B, 0x00000 } },	// RightFloor
+			{ 3944, 8, 1, { 0x022A2, 0x00000 } },	// RightTee
+			{ 3952, 13, 1, { 0x021A6, 0x00000 } },	// RightTeeArrow
+			{ 3965, 14, 1, { 0x0295B, 0x00000 } },	// RightTeeVector
+			{ 3979, 13, 1, { 0x022B3, 0x00000 } },	// RightTriangle
+			{ 3992, 16, 1, { 0x029D0, 0x00000 } },	// RightTriangleBar
+			{ 4008, 18, 1, { 0x022B5, 0x00000 } },	// RightTriangleEqual
+			{ 4026, 17, 1, { 0x0294F, 0x00000 } },	// RightUpDownVector
+			{ 4043, 16, 1, { 0x0295C, 0x00000 } },	// RightUpTeeVector
+			{ 4059, 13, 1, { 0x021BE, 0x00000 } },	// RightUpVector
+			{ 4072, 16, 1, { 0x02954, 0x00000 } },	// RightUpVectorBar
+			{ 4088, 11, 1, { 0x021C0, 0x00000 } },	// RightVector
+			{ 4099, 14, 1, { 0x02953, 0x00000 } },	// RightVectorBar
+			{ 4113, 10, 1, { 0x021D2, 0x00000 } },	// Rightarrow
+			{ 4123, 4, 1, { 0x0211D, 0x00000 } },	// Ropf
+			{ 4127, 12, 1, { 0x02970, 0x00000 } },	// RoundImplies
+			{ 4139, 11, 1, { 0x021DB, 0x00000 } },	// Rrightarrow
+			{ 4150, 4, 1, { 0x0211B, 0x00000 } },	// Rscr
+			{ 4154, 3, 1, { 0x021B1, 0x00000 } },	// Rsh
+			{ 4157, 11, 1, { 0x029F4, 0x00000 } },	// RuleDelayed
+			{ 4168, 6, 1, { 0x00429, 0x00000 } },	// SHCHcy
+			{ 4174, 4, 1, { 0x00428, 0x00000 } },	// SHcy
+			{ 4178, 6, 1, { 0x0042C, 0x00000 } },	// SOFTcy
+			{ 4184, 6, 1, { 0x0015A, 0x00000 } },	// Sacute
+			{ 4190, 2, 1, { 0x02ABC, 0x00000 } },	// Sc
+			{ 4192, 6, 1, { 0x00160, 0x00000 } },	// Scaron
+			{ 4198, 6, 1, { 0x0015E, 0x00000 } },	// Scedil
+			{ 4204, 5, 1, { 0x0015C, 0x00000 } },	// Scirc
+			{ 4209, 3, 1, { 0x00421, 0x00000 } },	// Scy
+			{ 4212, 3, 1, { 0x1D516, 0x00000 } },	// Sfr
+			{ 4215, 14, 1, { 0x02193, 0x00000 } },	// ShortDownArrow
+			{ 4229, 14, 1, { 0x02190, 0x00000 } },	// ShortLeftArrow
+			{ 4243, 15, 1, { 0x02192, 0x00000 } },	// ShortRightArrow
+			{ 4258, 12, 1, { 0x02191, 0x00000 } },	// ShortUpArrow
+			{ 4270, 5, 1, { 0x003A3, 0x00000 } },	// Sigma
+			{ 4275, 11, 1, { 0x02218, 0x00000 } },	// SmallCircle
+			{ 4286, 4, 1, { 0x1D54A, 0x00000 } },	// Sopf
+			{ 4290, 4, 1, { 0x0221A, 0x00000 } },	// Sqrt
+			{ 4294, 6, 1, { 0x025A1, 0x00000 } },	// Square
+			{ 4300, 18, 1, { 0x02293, 0x00000 } },	// SquareIntersection
+			{ 4318, 12, 1, { 0x0228F, 0x00000 } },	// SquareSubset
+			{ 4330, 17, 1, { 0x02291, 0x00000 } },	// SquareSubsetEqual
+			{ 4347, 14, 1, { 0x02290, 0x00000 } },	// SquareSuperset
+			{ 4361, 19, 1, { 0x02292, 0x00000 } },	// SquareSupersetEqual
+			{ 4380, 11, 1, { 0x02294, 0x00000 } },	// SquareUnion
+			{ 4391, 4, 1, { 0x1D4AE, 0x00000 } },	// Sscr
+			{ 4395, 4, 1, { 0x022C6, 0x00000 } },	// Star
+			{ 4399, 3, 1, { 0x022D0, 0x00000 } },	// Sub
+			{ 4402, 6, 1, { 0x022D0, 0x00000 } },	// Subset
+			{ 4408, 11, 1, { 0x02286, 0x00000 } },	// SubsetEqual
+			{ 4419, 8, 1, { 0x0227B, 0x00000 } },	// Succeeds
+			{ 4427, 13, 1, { 0x02AB0, 0x00000 } },	// SucceedsEqual
+			{ 4440, 18, 1, { 0x0227D, 0x00000 } },	// SucceedsSlantEqual
+			{ 4458, 13, 1, { 0x0227F, 0x00000 } },	// SucceedsTilde
+			{ 4471, 8, 1, { 0x0220B, 0x00000 } },	// SuchThat
+			{ 4479, 3, 1, { 0x02211, 0x00000 } },	// Sum
+			{ 4482, 3, 1, { 0x022D1, 0x00000 } },	// Sup
+			{ 4485, 8, 1, { 0x02283, 0x00000 } },	// Superset
+			{ 4493, 13, 1, { 0x02287, 0x00000 } },	// SupersetEqual
+			{ 4506, 6, 1, { 0x022D1, 0x00000 } },	// Supset
+			{ 4512, 5, 1, { 0x000DE, 0x00000 } },	// THORN
+			{ 4517, 5, 1, { 0x02122, 0x00000 } },	// TRADE
+			{ 4522, 5, 1, { 0x0040B, 0x00000 } },	// TSHcy
+			{ 4527, 4, 1, { 0x00426, 0x00000 } },	// TScy
+			{ 4531, 3, 1, { 0x00009, 0x00000 } },	// Tab
+			{ 4534, 3, 1, { 0x003A4, 0x00000 } },	// Tau
+			{ 4537, 6, 1, { 0x00164, 0x00000 } },	// Tcaron
+			{ 4543, 6, 1, { 0x00162, 0x00000 } },	// Tcedil
+			{ 4549, 3, 1, { 0x00422, 0x00000 } },	// Tcy
+			{ 4552, 3, 1, { 0x1D517, 0x00000 } },	// Tfr
+			{ 4555, 9, 1, { 0x02234, 0x00000 } },	// Therefore
+			{ 4564, 5, 1, { 0x00398, 0x00000 } },	// Theta
+			{ 4569, 10, 2, { 0x0205F, 0x0200A } },	// ThickSpace
+			{ 4579, 9, 1, { 0x02009, 0x00000 } },	// ThinSpace
+			{ 4588, 5, 1, { 0x0223C, 0x00000 } },	// Tilde
+			{ 4593, 10, 1, { 0x02243, 0x00000 } },	// TildeEqual
+			{ 4603, 14, 1, { 0x02245, 0x00000 } },	// TildeFullEqual
+			{ 4617, 10, 1, { 0x02248, 0x00000 } },	// TildeTilde
+			{ 4627, 4, 1, { 0x1D54B, 0x00000 } },	// Topf
+			{ 4631, 9, 1, { 0x020DB, 0x00000 } },	// TripleDot
+			{ 4640, 4, 1, { 0x1D4AF, 0x00000 } },	// Tscr
+			{ 4644, 6, 1, { 0x00166, 0x00000 } },	// Tstrok
+			{ 4650, 6, 1, { 0x000DA, 0x00000 } },	// Uacute
+			{ 4656, 4, 1, { 0x0219F, 0x00000 } },	// Uarr
+			{ 4660, 8, 1, { 0x02949, 0x00000 } },	// Uarrocir
+			{ 4668, 5, 1, { 0x0040E, 0x00000 } },	// Ubrcy
+			{ 4673, 6, 1, { 0x0016C, 0x00000 } },	// Ubreve
+			{ 4679, 5, 1, { 0x000DB, 0x00000 } },	// Ucirc
+			{ 4684, 3, 1, { 0x00423, 0x00000 } },	// Ucy
+			{ 4687, 6, 1, { 0x00170, 0x00000 } },	// Udblac
+			{ 4693, 3, 1, { 0x1D518, 0x00000 } },	// Ufr
+			{ 4696, 6, 1, { 0x000D9, 0x00000 } },	// Ugrave
+			{ 4702, 5, 1, { 0x0016A, 0x00000 } },	// Umacr
+			{ 4707, 8, 1, { 0x0005F, 0x00000 } },	// UnderBar
+			{ 4715, 10, 1, { 0x023DF, 0x00000 } },	// UnderBrace
+			{ 4725, 12, 1, { 0x023B5, 0x00000 } },	// UnderBracket
+			{ 4737, 16, 1, { 0x023DD, 0x00000 } },	// UnderParenthesis
+			{ 4753, 5, 1, { 0x022C3, 0x00000 } },	// Union
+			{ 4758, 9, 1, { 0x0228E, 0x00000 } },	// UnionPlus
+			{ 4767, 5, 1, { 0x00172, 0x00000 } },	// Uogon
+			{ 4772, 4, 1, { 0x1D54C, 0x00000 } },	// Uopf
+			{ 4776, 7, 1, { 0x02191, 0x00000 } },	// UpArrow
+			{ 4783, 10, 1, { 0x02912, 0x00000 } },	// UpArrowBar
+			{ 4793, 16, 1, { 0x021C5, 0x00000 } },	// UpArrowDownArrow
+			{ 4809, 11, 1, { 0x02195, 0x00000 } },	// UpDownArrow
+			{ 4820, 13, 1, { 0x0296E, 0x00000 } },	// UpEquilibrium
+			{ 4833, 5, 1, { 0x022A5, 0x00000 } },	// UpTee
+			{ 4838, 10, 1, { 0x021A5, 0x00000 } },	// UpTeeArrow
+			{ 4848, 7, 1, { 0x021D1, 0x00000 } },	// Uparrow
+			{ 4855, 11, 1, { 0x021D5, 0x00000 } },	// Updownarrow
+			{ 4866, 14, 1, { 0x02196, 0x00000 } },	// UpperLeftArrow
+			{ 4880, 15, 1, { 0x02197, 0x00000 } },	// UpperRightArrow
+			{ 4895, 4, 1, { 0x003D2, 0x00000 } },	// Upsi
+			{ 4899, 7, 1, { 0x003A5, 0x00000 } },	// Upsilon
+			{ 4906, 5, 1, { 0x0016E, 0x00000 } },	// Uring
+			{ 4911, 4, 1, { 0x1D4B0, 0x00000 } },	// Uscr
+			{ 4915, 6, 1, { 0x00168, 0x00000 } },	// Utilde
+			{ 4921, 4, 1, { 0x000DC, 0x00000 } },	// Uuml
+			{ 4925, 5, 1, { 0x022AB, 0x00000 } },	// VDash
+			{ 4930, 4, 1, { 0x02AEB, 0x00000 } },	// Vbar
+			{ 4934, 3, 1, { 0x00412, 0x00000 } },	// Vcy
+			{ 4937, 5, 1, { 0x022A9, 0x00000 } },	// Vdash
+			{ 4942, 6, 1, { 0x02AE6, 0x00000 } },	// Vdashl
+			{ 4948, 3, 1, { 0x022C1, 0x00000 } },	// Vee
+			{ 4951, 6, 1, { 0x02016, 0x00000 } },	// Verbar
+			{ 4957, 4, 1, { 0x02016, 0x00000 } },	// Vert
+			{ 4961, 11, 1, { 0x02223, 0x00000 } },	// VerticalBar
+			{ 4972, 12, 1, { 0x0007C, 0x00000 } },	// VerticalLine
+			{ 4984, 17, 1, { 0x02758, 0x00000 } },	// VerticalSeparator
+			{ 5001, 13, 1, { 0x02240, 0x00000 } },	// VerticalTilde
+			{ 5014, 13, 1, { 0x0200A, 0x00000 } },	// VeryThinSpace
+			{ 5027, 3, 1, { 0x1D519, 0x00000 } },	// Vfr
+			{ 5030, 4, 1, { 0x1D54D, 0x00000 } },	// Vopf
+			{ 5034, 4, 1, { 0x1D4B1, 0x00000 } },	// Vscr
+			{ 5038, 6, 1, { 0x022AA, 0x00000 } },	// Vvdash
+			{ 5044, 5, 1, { 0x00174, 0x00000 } },	// Wcirc
+			{ 5049, 5, 1, { 0x022C0, 0x00000 } },	// Wedge
+			{ 5054, 3, 1, { 0x1D51A, 0x00000 } },	// Wfr
+			{ 5057, 4, 1, { 0x1D54E, 0x00000 } },	// Wopf
+			{ 5061, 4, 1, { 0x1D4B2, 0x00000 } },	// Wscr
+			{ 5065, 3, 1, { 0x1D51B, 0x00000 } },	// Xfr
+			{ 5068, 2, 1, { 0x0039E, 0x00000 } },	// Xi
+			{ 5070, 4, 1, { 0x1D54F, 0x00000 } },	// Xopf
+			{ 5074, 4, 1, { 0x1D4B3, 0x00000 } },	// Xscr
+			{ 5078, 4, 1, { 0x0042F, 0x00000 } },	// YAcy
+			{ 5082, 4, 1, { 0x00407, 0x00000 } },	// YIcy
+			{ 5086, 4, 1, { 0x0042E, 0x00000 } },	// YUcy
+			{ 5090, 6, 1, { 0x000DD, 0x00000 } },	// Yacute
+			{ 5096, 5, 1, { 0x00176, 0x00000 } },	// Ycirc
+			{ 5101, 3, 1, { 0x0042B, 0x00000 } },	// Ycy
+			{ 5104, 3, 1, { 0x1D51C, 0x00000 } },	// Yfr
+			{ 5107, 4, 1, { 0x1D550, 0x00000 } },	// Yopf
+			{ 5111, 4, 1, { 0x1D4B4, 0x00000 } },	// Yscr
+			{ 5115, 4, 1, { 0x00178, 0x00000 } },	// Yuml
+			{ 5119, 4, 1, { 0x00416, 0x00000 } },	// ZHcy
+			{ 5123, 6, 1, { 0x00179, 0x00000 } },	// Zacute
+			{ 5129, 6, 1, { 0x0017D, 0x00000 } },	// Zcaron
+			{ 5135, 3, 1, { 0x00417, 0x00000 } },	// Zcy
+			{ 5138, 4, 1, { 0x0017B, 0x00000 } },	// Zdot
+			{ 5142, 14, 1, { 0x0200B, 0x00000 } },	// ZeroWidthSpace
+			{ 5156, 4, 1, { 0x00396, 0x00000 } },	// Zeta
+			{ 5160, 3, 1, { 0x02128, 0x00000 } },	// Zfr
+			{ 5163, 4, 1, { 0x02124, 0x00000 } },	// Zopf
+			{ 5167, 4, 1, { 0x1D4B5, 0x00000 } },	// Zscr
+			{ 5171, 6, 1, { 0x000E1, 0x00000 } },	// aacute
+			{ 5177, 6, 1, { 0x00103, 0x00000 } },	// abreve
+			{ 5183, 2, 1, { 0x0223E, 0x00000 } },	// ac
+			{ 5185, 3, 2, { 0x0223E, 0x00333 } },	// acE
+			{ 5188, 3, 1, { 0x0223F, 0x00000 } },	// acd
+			{ 5191, 5, 1, { 0x000E2, 0x00000 } },	// acirc
+			{ 5196, 5, 1, { 0x000B4, 0x00000 } },	// acute
+			{ 5201, 3, 1, { 0x00430, 0x00000 } },	// acy
+			{ 5204, 5, 1, { 0x000E6, 0x00000 } },	// aelig
+			{ 5209, 2, 1, { 0x02061, 0x00000 } },	// af
+			{ 5211, 3, 1, { 0x1D51E, 0x00000 } },	// afr
+			{ 5214, 6, 1, { 0x000E0, 0x00000 } },	// agrave
+			{ 5220, 7, 1, { 0x02135, 0x00000 } },	// alefsym
+			{ 5227, 5, 1, { 0x02135, 0x00000 } },	// aleph
+			{ 5232, 5, 1, { 0x003B1, 0x00000 } },	// alpha
+			{ 5237, 5, 1, { 0x00101, 0x00000 } },	// amacr
+			{ 5242, 5, 1, { 0x02A3F, 0x00000 } },	// amalg
+			{ 5247, 3, 1, { 0x00026, 0x00000 } },	// amp
+			{ 5250, 3, 1, { 0x02227, 0x00000 } },	// and
+			{ 5253, 6, 1, { 0x02A55, 0x00000 } },	// andand
+			{ 5259, 4, 1, { 0x02A5C, 0x00000 } },	// andd
+			{ 5263, 8, 1, { 0x02A58, 0x00000 } },	// andslope
+			{ 5271, 4, 1, { 0x02A5A, 0x00000 } },	// andv
+			{ 5275, 3, 1, { 0x02220, 0x00000 } },	// ang
+			{ 5278, 4, 1, { 0x029A4, 0x00000 } },	// ange
+			{ 5282, 5, 1, { 0x02220, 0x00000 } },	// angle
+			{ 5287, 6, 1, { 0x02221, 0x00000 } },	// angmsd
+			{ 5293, 8, 1, { 0x029A8, 0x00000 } },	// angmsdaa
+			{ 5301, 8, 1, { 0x029A9, 0x00000 } },	// angmsdab
+			{ 5309, 8, 1, { 0x029AA, 0x00000 } },	// angmsdac
+			{ 5317, 8, 1, { 0x029AB, 0x00000 } },	// angmsdad
+			{ 5325, 8, 1, { 0x029AC, 0x00000 } },	// angmsdae
+			{ 5333, 8, 1, { 0x029AD, 0x00000 } },	// angmsdaf
+			{ 5341, 8, 1, { 0x029AE, 0x00000 } },	// angmsdag
+			{ 5349, 8, 1, { 0x029AF, 0x00000 } },	// angmsdah
+			{ 5357, 5, 1, { 0x0221F, 0x00000 } },	// angrt
+			{ 5362, 7, 1, { 0x022BE, 0x00000 } },	// angrtvb
+			{ 5369, 8, 1, { 0x0299D, 0x00000 } },	// angrtvbd
+			{ 5377, 6, 1, { 0x02222, 0x00000 } },	// angsph
+			{ 5383, 5, 1, { 0x000C5, 0x00000 } },	// angst
+			{ 5388, 7, 1, { 0x0237C, 0x00000 } },	// angzarr
+			{ 5395, 5, 1, { 0x00105, 0x00000 } },	// aogon
+			{ 5400, 4, 1, { 0x1D552, 0x00000 } },	// aopf
+			{ 5404, 2, 1, { 0x02248, 0x00000 } },	// ap
+			{ 5406, 3, 1, { 0x02A70, 0x00000 } },	// apE
+			{ 5409, 6, 1, { 0x02A6F, 0x00000 } },	// apacir
+			{ 5415, 3, 1, { 0x0224A, 0x00000 } },	// ape
+			{ 5418, 4, 1, { 0x0224B, 0x00000 } },	// apid
+			{ 5422, 4, 1, { 0x00027, 0x00000 } },	// apos
+			{ 5426, 6, 1, { 0x02248, 0x00000 } },	// approx
+			{ 5432, 8, 1, { 0x0224A, 0x00000 } },	// approxeq
+			{ 5440, 5, 1, { 0x000E5, 0x00000 } },	// aring
+			{ 5445, 4, 1, { 0x1D4B6, 0x00000 } },	// ascr
+			{ 5449, 3, 1, { 0x0002A, 0x00000 } },	// ast
+			{ 5452, 5, 1, { 0x02248, 0x00000 } },	// asymp
+			{ 5457, 7, 1, { 0x0224D, 0x00000 } },	// asympeq
+			{ 5464, 6, 1, { 0x000E3, 0x00000 } },	// atilde
+			{ 5470, 4, 1, { 0x000E4, 0x00000 } },	// auml
+			{ 5474, 8, 1, { 0x02233, 0x00000 } },	// awconint
+			{ 5482, 5, 1, { 0x02A11, 0x00000 } },	// awint
+			{ 5487, 4, 1, { 0x02AED, 0x00000 } },	// bNot
+			{ 5491, 8, 1, { 0x0224C, 0x00000 } },	// backcong
+			{ 5499, 11, 1, { 0x003F6, 0x00000 } },	// backepsilon
+			{ 5510, 9, 1, { 0x02035, 0x00000 } },	// backprime
+			{ 5519, 7, 1, { 0x0223D, 0x00000 } },	// backsim
+			{ 5526, 9, 1, { 0x022CD, 0x00000 } },	// backsimeq
+			{ 5535, 6, 1, { 0x022BD, 0x00000 } },	// barvee
+			{ 5541, 6, 1, { 0x02305, 0x00000 } },	// barwed
+			{ 5547, 8, 1, { 0x02305, 0x00000 } },	// barwedge
+			{ 5555, 4, 1, { 0x023B5, 0x00000 } },	// bbrk
+			{ 5559, 8, 1, { 0x023B6, 0x00000 } },	// bbrktbrk
+			{ 5567, 5, 1, { 0x0224C, 0x00000 } },	// bcong
+			{ 5572, 3, 1, { 0x00431, 0x00000 } },	// bcy
+			{ 5575, 5, 1, { 0x0201E, 0x00000 } },	// bdquo
+			{ 5580, 6, 1, { 0x02235, 0x00000 } },	// becaus
+			{ 5586, 7, 1, { 0x02235, 0x00000 } },	// because
+			{ 5593, 7, 1, { 0x029B0, 0x00000 } },	// bemptyv
+			{ 5600, 5, 1, { 0x003F6, 0x00000 } },	// bepsi
+			{ 5605, 6, 1, { 0x0212C, 0x00000 } },	// bernou
+			{ 5611, 4, 1, { 0x003B2, 0x00000 } },	// beta
+			{ 5615, 4, 1, { 0x02136, 0x00000 } },	// beth
+			{ 5619, 7, 1, { 0x0226C, 0x00000 } },	// between
+			{ 5626, 3, 1, { 0x1D51F, 0x00000 } },	// bfr
+			{ 5629, 6, 1, { 0x022C2, 0x00000 } },	// bigcap
+			{ 5635, 7, 1, { 0x025EF, 0x00000 } },	// bigcirc
+			{ 5642, 6, 1, { 0x022C3, 0x00000 } },	// bigcup
+			{ 5648, 7, 1, { 0x02A00, 0x00000 } },	// bigodot
+			{ 5655, 8, 1, { 0x02A01, 0x00000 } },	// bigoplus
+			{ 5663, 9, 1, { 0x02A02, 0x00000 } },	// bigotimes
+			{ 5672, 8, 1, { 0x02A06, 0x00000 } },	// bigsqcup
+			{ 5680, 7, 1, { 0x02605, 0x00000 } },	// bigstar
+			{ 5687, 15, 1, { 0x025BD, 0x00000 } },	// bigtriangledown
+			{ 5702, 13, 1, { 0x025B3, 0x00000 } },	// bigtriangleup
+			{ 5715, 8, 1, { 0x02A04, 0x00000 } },	// biguplus
+			{ 5723, 6, 1, { 0x022C1, 0x00000 } },	// bigvee
+			{ 5729, 8, 1, { 0x022C0, 0x00000 } },	// bigwedge
+			{ 5737, 6, 1, { 0x0290D, 0x00000 } },	// bkarow
+			{ 5743, 12, 1, { 0x029EB, 0x00000 } },	// blacklozenge
+			{ 5755, 11, 1, { 0x025AA, 0x00000 } },	// blacksquare
+			{ 5766, 13, 1, { 0x025B4, 0x00000 } },	// blacktriangle
+			{ 5779, 17, 1, { 0x025BE, 0x00000 } },	// blacktriangledown
+			{ 5796, 17, 1, { 0x025C2, 0x00000 } },	// blacktriangleleft
+			{ 5813, 18, 1, { 0x025B8, 0x00000 } },	// blacktriangleright
+			{ 5831, 5, 1, { 0x02423, 0x00000 } },	// blank
+			{ 5836, 5, 1, { 0x02592, 0x00000 } },	// blk12
+			{ 5841, 5, 1, { 0x02591, 0x00000 } },	// blk14
+			{ 5846, 5, 1, { 0x02593, 0x00000 } },	// blk34
+			{ 5851, 5, 1, { 0x02588, 0x00000 } },	// block
+			{ 5856, 3, 2, { 0x0003D, 0x020E5 } },	// bne
+			{ 5859, 7, 2, { 0x02261, 0x020E5 } },	// bnequiv
+			{ 5866, 4, 1, { 0x02310, 0x00000 } },	// bnot
+			{ 5870, 4, 1, { 0x1D553, 0x00000 } },	// bopf
+			{ 5874, 3, 1, { 0x022A5, 0x00000 } },	// bot
+			{ 5877, 6, 1, { 0x022A5, 0x00000 } },	// bottom
+			{ 5883, 6, 1, { 0x022C8, 0x00000 } },	// bowtie
+			{ 5889, 5, 1, { 0x02557, 0x00000 } },	// boxDL
+			{ 5894, 5, 1, { 0x02554, 0x00000 } },	// boxDR
+			{ 5899, 5, 1, { 0x02556, 0x00000 } },	// boxDl
+			{ 5904, 5, 1, { 0x02553, 0x00000 } },	// boxDr
+			{ 5909, 4, 1, { 0x02550, 0x00000 } },	// boxH
+			{ 5913, 5, 1, { 0x02566, 0x00000 } },	// boxHD
+			{ 5918, 5, 1, { 0x02569, 0x00000 } },	// boxHU
+			{ 5923, 5, 1, { 0x02564, 0x00000 } },	// boxHd
+			{ 5928, 5, 1, { 0x02567, 0x00000 } },	// boxHu
+			{ 5933, 5, 1, { 0x0255D, 0x00000 } },	// boxUL
+			{ 5938, 5, 1, { 0x0255A, 0x00000 } },	// boxUR
+			{ 5943, 5, 1, { 0x0255C, 0x00000 } },	// boxUl
+			{ 5948, 5, 1, { 0x02559, 0x00000 } },	// boxUr
+			{ 5953, 4, 1, { 0x02551, 0x00000 } },	// boxV
+			{ 5957, 5, 1, { 0x0256C, 0x00000 } },	// boxVH
+			{ 5962, 5, 1, { 0x02563, 0x00000 } },	// boxVL
+			{ 5967, 5, 1, { 0x02560, 0x00000 } },	// boxVR
+			{ 5972, 5, 1, { 0x0256B, 0x00000 } },	// boxVh
+			{ 5977, 5, 1, { 0x02562, 0x00000 } },	// boxVl
+			{ 5982, 5, 1, { 0x0255F, 0x00000 } },	// boxVr
+			{ 5987, 6, 1, { 0x029C9, 0x00000 } },	// boxbox
+			{ 5993, 5, 1, { 0x02555, 0x00000 } },	// boxdL
+			{ 5998, 5, 1, { 0x02552, 0x00000 } },	// boxdR
+			{ 6003, 5, 1, { 0x02510, 0x00000 } },	// boxdl
+			{ 6008, 5, 1, { 0x0250C, 0x00000 } },	// boxdr
+			{ 6013, 4, 1, { 0x02500, 0x00000 } },	// boxh
+			{ 6017, 5, 1, { 0x02565, 0x00000 } },	// boxhD
+			{ 6022, 5, 1, { 0x02568, 0x00000 } },	// boxhU
+			{ 6027, 5, 1, { 0x0252C, 0x00000 } },	// boxhd
+			{ 6032, 5, 1, { 0x02534, 0x00000 } },	// boxhu
+			{ 6037, 8, 1, { 0x0229F, 0x00000 } },	// boxminus
+			{ 6045, 7, 1, { 0x0229E, 0x00000 } },	// boxplus
+			{ 6052, 8, 1, { 0x022A0, 0x00000 } },	// boxtimes
+			{ 6060, 5, 1, { 0x0255B, 0x00000 } },	// boxuL
+			{ 6065, 5, 1, { 0x02558, 0x00000 } },	// boxuR
+			{ 6070, 5, 1, { 0x02518, 0x00000 } },	// boxul
+			{ 6075, 5, 1, { 0x02514, 0x00000 } },	// boxur
+			{ 6080, 4, 1, { 0x02502, 0x00000 } },	// boxv
+			{ 6084, 5, 1, { 0x0256A, 0x00000 } },	// boxvH
+			{ 6089, 5, 1, { 0x02561, 0x00000 } },	// boxvL
+			{ 6094, 5, 1, { 0x0255E, 0x00000 } },	// boxvR
+			{ 6099, 5, 1, { 0x0253C, 0x00000 } },	// boxvh
+			{ 6104, 5, 1, { 0x02524, 0x00000 } },	// boxvl
+			{ 6109, 5, 1, { 0x0251C, 0x00000 } },	// boxvr
+			{ 6114, 6, 1, { 0x02035, 0x00000 } },	// bprime
+			{ 6120, 5, 1, { 0x002D8, 0x00000 } },	// breve
+			{ 6125, 6, 1, { 0x000A6, 0x00000 } },	// brvbar
+			{ 6131, 4, 1, { 0x1D4B7, 0x00000 } },	// bscr
+			{ 6135, 5, 1, { 0x0204F, 0x00000 } },	// bsemi
+			{ 6140, 4, 1, { 0x0223D, 0x00000 } },	// bsim
+			{ 6144, 5, 1, { 0x022CD, 0x00000 } },	// bsime
+			{ 6149, 4, 1, { 0x0005C, 0x00000 } },	// bsol
+			{ 6153, 5, 1, { 0x029C5, 0x00000 } },	// bsolb
+			{ 6158, 8, 1, { 0x027C8, 0x00000 } },	// bsolhsub
+			{ 6166, 4, 1, { 0x02022, 0x00000 } },	// bull
+			{ 6170, 6, 1, { 0x02022, 0x00000 } },	// bullet
+			{ 6176, 4, 1, { 0x0224E, 0x00000 } },	// bump
+			{ 6180, 5, 1, { 0x02AAE, 0x00000 } },	// bumpE
+			{ 6185, 5, 1, { 0x0224F, 0x00000 } },	// bumpe
+			{ 6190, 6, 1, { 0x0224F, 0x00000 } },	// bumpeq
+			{ 6196, 6, 1, { 0x00107, 0x00000 } },	// cacute
+			{ 6202, 3, 1, { 0x02229, 0x00000 } },	// cap
+			{ 6205, 6, 1, { 0x02A44, 0x00000 } },	// capand
+			{ 6211, 8, 1, { 0x02A49, 0x00000 } },	// capbrcup
+			{ 6219, 6, 1, { 0x02A4B, 0x00000 } },	// capcap
+			{ 6225, 6, 1, { 0x02A47, 0x00000 } },	// capcup
+			{ 6231, 6, 1, { 0x02A40, 0x00000 } },	// capdot
+			{ 6237, 4, 2, { 0x02229, 0x0FE00 } },	// caps
+			{ 6241, 5, 1, { 0x02041, 0x00000 } },	// caret
+			{ 6246, 5, 1, { 0x002C7, 0x00000 } },	// caron
+			{ 6251, 5, 1, { 0x02A4D, 0x00000 } },	// ccaps
+			{ 6256, 6, 1, { 0x0010D, 0x00000 } },	// ccaron
+			{ 6262, 6, 1, { 0x000E7, 0x00000 } },	// ccedil
+			{ 6268, 5, 1, { 0x00109, 0x00000 } },	// ccirc
+			{ 6273, 5, 1, { 0x02A4C, 0x00000 } },	// ccups
+			{ 6278, 7, 1, { 0x02A50, 0x00000 } },	// ccupssm
+			{ 6285, 4, 1, { 0x0010B, 0x00000 } },	// cdot
+			{ 6289, 5, 1, { 0x000B8, 0x00000 } },	// cedil
+			{ 6294, 7, 1, { 0x029B2, 0x00000 } },	// cemptyv
+			{ 6301, 4, 1, { 0x000A2, 0x00000 } },	// cent
+			{ 6305, 9, 1, { 0x000B7, 0x00000 } },	// centerdot
+			{ 6314, 3, 1, { 0x1D520, 0x00000 } },	// cfr
+			{ 6317, 4, 1, { 0x00447, 0x00000 } },	// chcy
+			{ 6321, 5, 1, { 0x02713, 0x00000 } },	// check
+			{ 6326, 9, 1, { 0x02713, 0x00000 } },	// checkmark
+			{ 6335, 3, 1, { 0x003C7, 0x00000 } },	// chi
+			{ 6338, 3, 1, { 0x025CB, 0x00000 } },	// cir
+			{ 6341, 4, 1, { 0x029C3, 0x00000 } },	// cirE
+			{ 6345, 4, 1, { 0x002C6, 0x00000 } },	// circ
+			{ 6349, 6, 1, { 0x02257, 0x00000 } },	// circeq
+			{ 6355, 15, 1, { 0x021BA, 0x00000 } },	// circlearrowleft
+			{ 6370, 16, 1, { 0x021BB, 0x00000 } },	// circlearrowright
+			{ 6386, 8, 1, { 0x000AE, 0x00000 } },	// circledR
+			{ 6394, 8, 1, { 0x024C8, 0x00000 } },	// circledS
+			{ 6402, 10, 1, { 0x0229B, 0x00000 } },	// circledast
+			{ 6412, 11, 1, { 0x0229A, 0x00000 } },	// circledcirc
+			{ 6423, 11, 1, { 0x0229D, 0x00000 } },	// circleddash
+			{ 6434, 4, 1, { 0x02257, 0x00000 } },	// cire
+			{ 6438, 8, 1, { 0x02A10, 0x00000 } },	// cirfnint
+			{ 6446, 6, 1, { 0x02AEF, 0x00000 } },	// cirmid
+			{ 6452, 7, 1, { 0x029C2, 0x00000 } },	// cirscir
+			{ 6459, 5, 1, { 0x02663, 0x00000 } },	// clubs
+			{ 6464, 8, 1, { 0x02663, 0x00000 } },	// clubsuit
+			{ 6472, 5, 1, { 0x0003A, 0x00000 } },	// colon
+			{ 6477, 6, 1, { 0x02254, 0x00000 } },	// colone
+			{ 6483, 7, 1, { 0x02254, 0x00000 } },	// coloneq
+			{ 6490, 5, 1, { 0x0002C, 0x00000 } },	// comma
+			{ 6495, 6, 1, { 0x00040, 0x00000 } },	// commat
+			{ 6501, 4, 1, { 0x02201, 0x00000 } },	// comp
+			{ 6505, 6, 1, { 0x02218, 0x00000 } },	// compfn
+			{ 6511, 10, 1, { 0x02201, 0x00000 } },	// complement
+			{ 6521, 9, 1, { 0x02102, 0x00000 } },	// complexes
+			{ 6530, 4, 1, { 0x02245, 0x00000 } },	// cong
+			{ 6534, 7, 1, { 0x02A6D, 0x00000 } },	// congdot
+			{ 6541, 6, 1, { 0x0222E, 0x00000 } },	// conint
+			{ 6547, 4, 1, { 0x1D554, 0x00000 } },	// copf
+			{ 6551, 6, 1, { 0x02210, 0x00000 } },	// coprod
+			{ 6557, 4, 1, { 0x000A9, 0x00000 } },	// copy
+			{ 6561, 6, 1, { 0x02117, 0x00000 } },	// copysr
+			{ 6567, 5, 1, { 0x021B5, 0x00000 } },	// crarr
+			{ 6572, 5, 1, { 0x02717, 0x00000 } },	// cross
+			{ 6577, 4, 1, { 0x1D4B8, 0x00000 } },	// cscr
+			{ 6581, 4, 1, { 0x02ACF, 0x00000 } },	// csub
+			{ 6585, 5, 1, { 0x02AD1, 0x00000 } },	// csube
+			{ 6590, 4, 1, { 0x02AD0, 0x00000 } },	// csup
+			{ 6594, 5, 1, { 0x02AD2, 0x00000 } },	// csupe
+			{ 6599, 5, 1, { 0x022EF, 0x00000 } },	// ctdot
+			{ 6604, 7, 1, { 0x02938, 0x00000 } },	// cudarrl
+			{ 6611, 7, 1, { 0x02935, 0x00000 } },	// cudarrr
+			{ 6618, 5, 1, { 0x022DE, 0x00000 } },	// cuepr
+			{ 6623, 5, 1, { 0x022DF, 0x00000 } },	// cuesc
+			{ 6628, 6, 1, { 0x021B6, 0x00000 } },	// cularr
+			{ 6634, 7, 1, { 0x0293D, 0x00000 } },	// cularrp
+			{ 6641, 3, 1, { 0x0222A, 0x00000 } },	// cup
+			{ 6644, 8, 1, { 0x02A48, 0x00000 } },	// cupbrcap
+			{ 6652, 6, 1, { 0x02A46, 0x00000 } },	// cupcap
+			{ 6658, 6, 1, { 0x02A4A, 0x00000 } },	// cupcup
+			{ 6664, 6, 1, { 0x0228D, 0x00000 } },	// cupdot
+			{ 6670, 5, 1, { 0x02A45, 0x00000 } },	// cupor
+			{ 6675, 4, 2, { 0x0222A, 0x0FE00 } },	// cups
+			{ 6679, 6, 1, { 0x021B7, 0x00000 } },	// curarr
+			{ 6685, 7, 1, { 0x0293C, 0x00000 } },	// curarrm
+			{ 6692, 11, 1, { 0x022DE, 0x00000 } },	// curlyeqprec
+			{ 6703, 11, 1, { 0x022DF, 0x00000 } },	// curlyeqsucc
+			{ 6714, 8, 1, { 0x022CE, 0x00000 } },	// curlyvee
+			{ 6722, 10, 1, { 0x022CF, 0x00000 } },	// curlywedge
+			{ 6732, 6, 1, { 0x000A4, 0x00000 } },	// curren
+			{ 6738, 14, 1, { 0x021B6, 0x00000 } },	// curvearrowleft
+			{ 6752, 15, 1, { 0x021B7, 0x00000 } },	// curvearrowright
+			{ 6767, 5, 1, { 0x022CE, 0x00000 } },	// cuvee
+			{ 6772, 5, 1, { 0x022CF, 0x00000 } },	// cuwed
+			{ 6777, 8, 1, { 0x02232, 0x00000 } },	// cwconint
+			{ 6785, 5, 1, { 0x02231, 0x00000 } },	// cwint
+			{ 6790, 6, 1, { 0x0232D, 0x00000 } },	// cylcty
+			{ 6796, 4, 1, { 0x021D3, 0x00000 } },	// dArr
+			{ 6800, 4, 1, { 0x02965, 0x00000 } },	// dHar
+			{ 6804, 6, 1, { 0x02020, 0x00000 } },	// dagger
+			{ 6810, 6, 1, { 0x02138, 0x00000 } },	// daleth
+			{ 6816, 4, 1, { 0x02193, 0x00000 } },	// darr
+			{ 6820, 4, 1, { 0x02010, 0x00000 } },	// dash
+			{ 6824, 5, 1, { 0x022A3, 0x00000 } },	// dashv
+			{ 6829, 7, 1, { 0x0290F, 0x00000 } },	// dbkarow
+			{ 6836, 5, 1, { 0x002DD, 0x00000 } },	// dblac
+			{ 6841, 6, 1, { 0x0010F, 0x00000 } },	// dcaron
+			{ 6847, 3, 1, { 0x00434, 0x00000 } },	// dcy
+			{ 6850, 2, 1, { 0x02146, 0x00000 } },	// dd
+			{ 6852, 7, 1, { 0x02021, 0x00000 } },	// ddagger
+			{ 6859, 5, 1, { 0x021CA, 0x00000 } },	// ddarr
+			{ 6864, 7, 1, { 0x02A77, 0x00000 } },	// ddotseq
+			{ 6871, 3, 1, { 0x000B0, 0x00000 } },	// deg
+			{ 6874, 5, 1, { 0x003B4, 0x00000 } },	// delta
+			{ 6879, 7, 1, { 0x029B1, 0x00000 } },	// demptyv
+			{ 6886, 6, 1, { 0x0297F, 0x00000 } },	// dfisht
+			{ 6892, 3, 1, { 0x1D521, 0x00000 } },	// dfr
+			{ 6895, 5, 1, { 0x021C3, 0x00000 } },	// dharl
+			{ 6900, 5, 1, { 0x021C2, 0x00000 } },	// dharr
+			{ 6905, 4, 1, { 0x022C4, 0x00000 } },	// diam
+			{ 6909, 7, 1, { 0x022C4, 0x00000 } },	// diamond
+			{ 6916, 11, 1, { 0x02666, 0x00000 } },	// diamondsuit
+			{ 6927, 5, 1, { 0x02666, 0x00000 } },	// diams
+			{ 6932, 3, 1, { 0x000A8, 0x00000 } },	// die
+			{ 6935, 7, 1, { 0x003DD, 0x00000 } },	// digamma
+			{ 6942, 5, 1, { 0x022F2, 0x00000 } },	// disin
+			{ 6947, 3, 1, { 0x000F7, 0x00000 } },	// div
+			{ 6950, 6, 1, { 0x000F7, 0x00000 } },	// divide
+			{ 6956, 13, 1, { 0x022C7, 0x00000 } },	// divideontimes
+			{ 6969, 6, 1, { 0x022C7, 0x00000 } },	// divonx
+			{ 6975, 4, 1, { 0x00452, 0x00000 } },	// djcy
+			{ 6979, 6, 1, { 0x0231E, 0x00000 } },	// dlcorn
+			{ 6985, 6, 1, { 0x0230D, 0x00000 } },	// dlcrop
+			{ 6991, 6, 1, { 0x00024, 0x00000 } },	// dollar
+			{ 6997, 4, 1, { 0x1D555, 0x00000 } },	// dopf
+			{ 7001, 3, 1, { 0x002D9, 0x00000 } },	// dot
+			{ 7004, 5, 1, { 0x02250, 0x00000 } },	// doteq
+			{ 7009, 8, 1, { 0x02251, 0x00000 } },	// doteqdot
+			{ 7017, 8, 1, { 0x02238, 0x00000 } },	// dotminus
+			{ 7025, 7, 1, { 0x02214, 0x00000 } },	// dotplus
+			{ 7032, 9, 1, { 0x022A1, 0x00000 } },	// dotsquare
+			{ 7041, 14, 1, { 0x02306, 0x00000 } },	// doublebarwedge
+			{ 7055, 9, 1, { 0x02193, 0x00000 } },	// downarrow
+			{ 7064, 14, 1, { 0x021CA, 0x00000 } },	// downdownarrows
+			{ 7078, 15, 1, { 0x021C3, 0x00000 } },	// downharpoonleft
+			{ 7093, 16, 1, { 0x021C2, 0x00000 } },	// downharpoonright
+			{ 7109, 8, 1, { 0x02910, 0x00000 } },	// drbkarow
+			{ 7117, 6, 1, { 0x0231F, 0x00000 } },	// drcorn
+			{ 7123, 6, 1, { 0x0230C, 0x00000 } },	// drcrop
+			{ 7129, 4, 1, { 0x1D4B9, 0x00000 } },	// dscr
+			{ 7133, 4, 1, { 0x00455, 0x00000 } },	// dscy
+			{ 7137, 4, 1, { 0x029F6, 0x00000 } },	// dsol
+			{ 7141, 6, 1, { 0x00111, 0x00000 } },	// dstrok
+			{ 7147, 5, 1, { 0x022F1, 0x00000 } },	// dtdot
+			{ 7152, 4, 1, { 0x025BF, 0x00000 } },	// dtri
+			{ 7156, 5, 1, { 0x025BE, 0x00000 } },	// dtrif
+			{ 7161, 5, 1, { 0x021F5, 0x00000 } },	// duarr
+			{ 7166, 5, 1, { 0x0296F, 0x00000 } },	// duhar
+			{ 7171, 7, 1, { 0x029A6, 0x00000 } },	// dwangle
+			{ 7178, 4, 1, { 0x0045F, 0x00000 } },	// dzcy
+			{ 7182, 8, 1, { 0x027FF, 0x00000 } },	// dzigrarr
+			{ 7190, 5, 1, { 0x02A77, 0x00000 } },	// eDDot
+			{ 7195, 4, 1, { 0x02251, 0x00000 } },	// eDot
+			{ 7199, 6, 1, { 0x000E9, 0x00000 } },	// eacute
+			{ 7205, 6, 1, { 0x02A6E, 0x00000 } },	// easter
+			{ 7211, 6, 1, { 0x0011B, 0x00000 } },	// ecaron
+			{ 7217, 4, 1, { 0x02256, 0x00000 } },	// ecir
+			{ 7221, 5, 1, { 0x000EA, 0x00000 } },	// ecirc
+			{ 7226, 6, 1, { 0x02255, 0x00000 } },	// ecolon
+			{ 7232, 3, 1, { 0x0044D, 0x00000 } },	// ecy
+			{ 7235, 4, 1, { 0x00117, 0x00000 } },	// edot
+			{ 7239, 2, 1, { 0x02147, 0x00000 } },	// ee
+			{ 7241, 5, 1, { 0x02252, 0x00000 } },	// efDot
+			{ 7246, 3, 1, { 0x1D522, 0x00000 } },	// efr
+			{ 7249, 2, 1, { 0x02A9A, 0x00000 } },	// eg
+			{ 7251, 6, 1, { 0x000E8, 0x00000 } },	// egrave
+			{ 7257, 3, 1, { 0x02A96, 0x00000 } },	// egs
+			{ 7260, 6, 1, { 0x02A98, 0x00000 } },	// egsdot
+			{ 7266, 2, 1, { 0x02A99, 0x00000 } },	// el
+			{ 7268, 8, 1, { 0x023E7, 0x00000 } },	// elinters
+			{ 7276, 3, 1, { 0x02113, 0x00000 } },	// ell
+			{ 7279, 3, 1, { 0x02A95, 0x00000 } },	// els
+			{ 7282, 6, 1, { 0x02A97, 0x00000 } },	// elsdot
+			{ 7288, 5, 1, { 0x00113, 0x00000 } },	// emacr
+			{ 7293, 5, 1, { 0x02205, 0x00000 } },	// empty
+			{ 7298, 8, 1, { 0x02205, 0x00000 } },	// emptyset
+			{ 7306, 6, 1, { 0x02205, 0x00000 } },	// emptyv
+			{ 7312, 4, 1, { 0x02003, 0x00000 } },	// emsp
+			{ 7316, 6, 1, { 0x02004, 0x00000 } },	// emsp13
+			{ 7322, 6, 1, { 0x02005, 0x00000 } },	// emsp14
+			{ 7328, 3, 1, { 0x0014B, 0x00000 } },	// eng
+			{ 7331, 4, 1, { 0x02002, 0x00000 } },	// ensp
+			{ 7335, 5, 1, { 0x00119, 0x00000 } },	// eogon
+			{ 7340, 4, 1, { 0x1D556, 0x00000 } },	// eopf
+			{ 7344, 4, 1, { 0x022D5, 0x00000 } },	// epar
+			{ 7348, 6, 1, { 0x029E3, 0x00000 } },	// eparsl
+			{ 7354, 5, 1, { 0x02A71, 0x00000 } },	// eplus
+			{ 7359, 4, 1, { 0x003B5, 0x00000 } },	// epsi
+			{ 7363, 7, 1, { 0x003B5, 0x00000 } },	// epsilon
+			{ 7370, 5, 1, { 0x003F5, 0x00000 } },	// epsiv
+			{ 7375, 6, 1, { 0x02256, 0x00000 } },	// eqcirc
+			{ 7381, 7, 1, { 0x02255, 0x00000 } },	// eqcolon
+			{ 7388, 5, 1, { 0x02242, 0x00000 } },	// eqsim
+			{ 7393, 10, 1, { 0x02A96, 0x00000 } },	// eqslantgtr
+			{ 7403, 11, 1, { 0x02A95, 0x00000 } },	// eqslantless
+			{ 7414, 6, 1, { 0x0003D, 0x00000 } },	// equals
+			{ 7420, 6, 1, { 0x0225F, 0x00000 } },	// equest
+			{ 7426, 5, 1, { 0x02261, 0x00000 } },	// equiv
+			{ 7431, 7, 1, { 0x02A78, 0x00000 } },	// equivDD
+			{ 7438, 8, 1, { 0x029E5, 0x00000 } },	// eqvparsl
+			{ 7446, 5, 1, { 0x02253, 0x00000 } },	// erDot
+			{ 7451, 5, 1, { 0x02971, 0x00000 } },	// erarr
+			{ 7456, 4, 1, { 0x0212F, 0x00000 } },	// escr
+			{ 7460, 5, 1, { 0x02250, 0x00000 } },	// esdot
+			{ 7465, 4, 1, { 0x02242, 0x00000 } },	// esim
+			{ 7469, 3, 1, { 0x003B7, 0x00000 } },	// eta
+			{ 7472, 3, 1, { 0x000F0, 0x00000 } },	// eth
+			{ 7475, 4, 1, { 0x000EB, 0x00000 } },	// euml
+			{ 7479, 4, 1, { 0x020AC, 0x00000 } },	// euro
+			{ 7483, 4, 1, { 0x00021, 0x00000 } },	// excl
+			{ 7487, 5, 1, { 0x02203, 0x00000 } },	// exist
+			{ 7492, 11, 1, { 0x02130, 0x00000 } },	// expectation
+			{ 7503, 12, 1, { 0x02147, 0x00000 } },	// exponentiale
+			{ 7515, 13, 1, { 0x02252, 0x00000 } },	// fallingdotseq
+			{ 7528, 3, 1, { 0x00444, 0x00000 } },	// fcy
+			{ 7531, 6, 1, { 0x02640, 0x00000 } },	// female
+			{ 7537, 6, 1, { 0x0FB03, 0x00000 } },	// ffilig
+			{ 7543, 5, 1, { 0x0FB00, 0x00000 } },	// fflig
+			{ 7548, 6, 1, { 0x0FB04, 0x00000 } },	// ffllig
+			{ 7554, 3, 1, { 0x1D523, 0x00000 } },	// ffr
+			{ 7557, 5, 1, { 0x0FB01, 0x00000 } },	// filig
+			{ 7562, 5, 2, { 0x00066, 0x0006A } },	// fjlig
+			{ 7567, 4, 1, { 0x0266D, 0x00000 } },	// flat
+			{ 7571, 5, 1, { 0x0FB02, 0x00000 } },	// fllig
+			{ 7576, 5, 1, { 0x025B1, 0x00000 } },	// fltns
+			{ 7581, 4, 1, { 0x00192, 0x00000 } },	// fnof
+			{ 7585, 4, 1, { 0x1D557, 0x00000 } },	// fopf
+			{ 7589, 6, 1, { 0x02200, 0x00000 } },	// forall
+			{ 7595, 4, 1, { 0x022D4, 0x00000 } },	// fork
+			{ 7599, 5, 1, { 0x02AD9, 0x00000 } },	// forkv
+			{ 7604, 8, 1, { 0x02A0D, 0x00000 } },	// fpartint
+			{ 7612, 6, 1, { 0x000BD, 0x00000 } },	// frac12
+			{ 7618, 6, 1, { 0x02153, 0x00000 } },	// frac13
+			{ 7624, 6, 1, { 0x000BC, 0x00000 } },	// frac14
+			{ 7630, 6, 1, { 0x02155, 0x00000 } },	// frac15
+			{ 7636, 6, 1, { 0x02159, 0x00000 } },	// frac16
+			{ 7642, 6, 1, { 0x0215B, 0x00000 } },	// frac18
+			{ 7648, 6, 1, { 0x02154, 0x00000 } },	// frac23
+			{ 7654, 6, 1, { 0x02156, 0x00000 } },	// frac25
+			{ 7660, 6, 1, { 0x000BE, 0x00000 } },	// frac34
+			{ 7666, 6, 1, { 0x02157, 0x00000 } },	// frac35
+			{ 7672, 6, 1, { 0x0215C, 0x00000 } },	// frac38
+			{ 7678, 6, 1, { 0x02158, 0x00000 } },	// frac45
+			{ 7684, 6, 1, { 0x0215A, 0x00000 } },	// frac56
+			{ 7690, 6, 1, { 0x0215D, 0x00000 } },	// frac58
+			{ 7696, 6, 1, { 0x0215E, 0x00000 } },	// frac78
+			{ 7702, 5, 1, { 0x02044, 0x00000 } },	// frasl
+			{ 7707, 5, 1, { 0x02322, 0x00000 } },	// frown
+			{ 7712, 4, 1, { 0x1D4BB, 0x00000 } },	// fscr
+			{ 7716, 2, 1, { 0x02267, 0x00000 } },	// gE
+			{ 7718, 3, 1, { 0x02A8C, 0x00000 } },	// gEl
+			{ 7721, 6, 1, { 0x001F5, 0x00000 } },	// gacute
+			{ 7727, 5, 1, { 0x003B3, 0x00000 } },	// gamma
+			{ 7732, 6, 1, { 0x003DD, 0x00000 } },	// gammad
+			{ 7738, 3, 1, { 0x02A86, 0x00000 } },	// gap
+			{ 7741, 6, 1, { 0x0011F, 0x00000 } },	// gbreve
+			{ 7747, 5, 1, { 0x0011D, 0x00000 } },	// gcirc
+			{ 7752, 3, 1, { 0x00433, 0x00000 } },	// gcy
+			{ 7755, 4, 1, { 0x00121, 0x00000 } },	// gdot
+			{ 7759, 2, 1, { 0x02265, 0x00000 } },	// ge
+			{ 7761, 3, 1, { 0x022DB, 0x00000 } },	// gel
+			{ 7764, 3, 1, { 0x02265, 0x00000 } },	// geq
+			{ 7767, 4, 1, { 0x02267, 0x00000 } },	// geqq
+			{ 7771, 8, 1, { 0x02A7E, 0x00000 } },	// geqslant
+			{ 7779, 3, 1, { 0x02A7E, 0x00000 } },	// ges
+			{ 7782, 5, 1, { 0x02AA9, 0x00000 } },	// gescc
+			{ 7787, 6, 1, { 0x02A80, 0x00000 } },	// gesdot
+			{ 7793, 7, 1, { 0x02A82, 0x00000 } },	// gesdoto
+			{ 7800, 8, 1, { 0x02A84, 0x00000 } },	// gesdotol
+			{ 7808, 4, 2, { 0x022DB, 0x0FE00 } },	// gesl
+			{ 7812, 6, 1, { 0x02A94, 0x00000 } },	// gesles
+			{ 7818, 3, 1, { 0x1D524, 0x00000 } },	// gfr
+			{ 7821, 2, 1, { 0x0226B, 0x00000 } },	// gg
+			{ 7823, 3, 1, { 0x022D9, 0x00000 } },	// ggg
+			{ 7826, 5, 1, { 0x02137, 0x00000 } },	// gimel
+			{ 7831, 4, 1, { 0x00453, 0x00000 } },	// gjcy
+			{ 7835, 2, 1, { 0x02277, 0x00000 } },	// gl
+			{ 7837, 3, 1, { 0x02A92, 0x00000 } },	// glE
+			{ 7840, 3, 1, { 0x02AA5, 0x00000 } },	// gla
+			{ 7843, 3, 1, { 0x02AA4, 0x00000 } },	// glj
+			{ 7846, 3, 1, { 0x02269, 0x00000 } },	// gnE
+			{ 7849, 4, 1, { 0x02A8A, 0x00000 } },	// gnap
+			{ 7853, 8, 1, { 0x02A8A, 0x00000 } },	// gnapprox
+			{ 7861, 3, 1, { 0x02A88, 0x00000 } },	// gne
+			{ 7864, 4, 1, { 0x02A88, 0x00000 } },	// gneq
+			{ 7868, 5, 1, { 0x02269, 0x00000 } },	// gneqq
+			{ 7873, 5, 1, { 0x022E7, 0x00000 } },	// gnsim
+			{ 7878, 4, 1, { 0x1D558, 0x00000 } },	// gopf
+			{ 7882, 5, 1, { 0x00060, 0x00000 } },	// grave
+			{ 7887, 4, 1, { 0x0210A, 0x00000 } },	// gscr
+			{ 7891, 4, 1, { 0x02273, 0x00000 } },	// gsim
+			{ 7895, 5, 1, { 0x02A8E, 0x00000 } },	// gsime
+			{ 7900, 5, 1, { 0x02A90, 0x00000 } },	// gsiml
+			{ 7905, 2, 1, { 0x0003E, 0x00000 } },	// gt
+			{ 7907, 4, 1, { 0x02AA7, 0x00000 } },	// gtcc
+			{ 7911, 5, 1, { 0x02A7A, 0x00000 } },	// gtcir
+			{ 7916, 5, 1, { 0x022D7, 0x00000 } },	// gtdot
+			{ 7921, 6, 1, { 0x02995, 0x00000 } },	// gtlPar
+			{ 7927, 7, 1, { 0x02A7C, 0x00000 } },	// gtquest
+			{ 7934, 9, 1, { 0x02A86, 0x00000 } },	// gtrapprox
+			{ 7943, 6, 1, { 0x02978, 0x00000 } },	// gtrarr
+			{ 7949, 6, 1, { 0x022D7, 0x00000 } },	// gtrdot
+			{ 7955, 9, 1, { 0x022DB, 0x00000 } },	// gtreqless
+			{ 7964, 10, 1, { 0x02A8C, 0x00000 } },	// gtreqqless
+			{ 7974, 7, 1, { 0x02277, 0x00000 } },	// gtrless
+			{ 7981, 6, 1, { 0x02273, 0x00000 } },	// gtrsim
+			{ 7987, 9, 2, { 0x02269, 0x0FE00 } },	// gvertneqq
+			{ 7996, 4, 2, { 0x02269, 0x0FE00 } },	// gvnE
+			{ 8000, 4, 1, { 0x021D4, 0x00000 } },	// hArr
+			{ 8004, 6, 1, { 0x0200A, 0x00000 } },	// hairsp
+			{ 8010, 4, 1, { 0x000BD, 0x00000 } },	// half
+			{ 8014, 6, 1, { 0x0210B, 0x00000 } },	// hamilt
+			{ 8020, 6, 1, { 0x0044A, 0x00000 } },	// hardcy
+			{ 8026, 4, 1, { 0x02194, 0x00000 } },	// harr
+			{ 8030, 7, 1, { 0x02948, 0x00000 } },	// harrcir
+			{ 8037, 5, 1, { 0x021AD, 0x00000 } },	// harrw
+			{ 8042, 4, 1, { 0x0210F, 0x00000 } },	// hbar
+			{ 8046, 5, 1, { 0x00125, 0x00000 } },	// hcirc
+			{ 8051, 6, 1, { 0x02665, 0x00000 } },	// hearts
+			{ 8057, 9, 1, { 0x02665, 0x00000 } },	// heartsuit
+			{ 8066, 6, 1, { 0x02026, 0x00000 } },	// hellip
+			{ 8072, 6, 1, { 0x022B9, 0x00000 } },	// hercon
+			{ 8078, 3, 1, { 0x1D525, 0x00000 } },	// hfr
+			{ 8081, 8, 1, { 0x02925, 0x00000 } },	// hksearow
+			{ 8089, 8, 1, { 0x02926, 0x00000 } },	// hkswarow
+			{ 8097, 5, 1, { 0x021FF, 0x00000 } },	// hoarr
+			{ 8102, 6, 1, { 0x0223B, 0x00000 } },	// homtht
+			{ 8108, 13, 1, { 0x021A9, 0x00000 } },	// hookleftarrow
+			{ 8121, 14, 1, { 0x021AA, 0x00000 } },	// hookrightarrow
+			{ 8135, 4, 1, { 0x1D559, 0x00000 } },	// hopf
+			{ 8139, 6, 1, { 0x02015, 0x00000 } },	// horbar
+			{ 8145, 4, 1, { 0x1D4BD, 0x00000 } },	// hscr
+			{ 8149, 6, 1, { 0x0210F, 0x00000 } },	// hslash
+			{ 8155, 6, 1, { 0x00127, 0x00000 } },	// hstrok
+			{ 8161, 6, 1, { 0x02043, 0x00000 } },	// hybull
+			{ 8167, 6, 1, { 0x02010, 0x00000 } },	// hyphen
+			{ 8173, 6, 1, { 0x000ED, 0x00000 } },	// iacute
+			{ 8179, 2, 1, { 0x02063, 0x00000 } },	// ic
+			{ 8181, 5, 1, { 0x000EE, 0x00000 } },	// icirc
+			{ 8186, 3, 1, { 0x00438, 0x00000 } },	// icy
+			{ 8189, 4, 1, { 0x00435, 0x00000 } },	// iecy
+			{ 8193, 5, 1, { 0x000A1, 0x00000 } },	// iexcl
+			{ 8198, 3, 1, { 0x021D4, 0x00000 } },	// iff
+			{ 8201, 3, 1, { 0x1D526, 0x00000 } },	// ifr
+			{ 8204, 6, 1, { 0x000EC, 0x00000 } },	// igrave
+			{ 8210, 2, 1, { 0x02148, 0x00000 } },	// ii
+			{ 8212, 6, 1, { 0x02A0C, 0x00000 } },	// iiiint
+			{ 8218, 5, 1, { 0x0222D, 0x00000 } },	// iiint
+			{ 8223, 6, 1, { 0x029DC, 0x00000 } },	// iinfin
+			{ 8229, 5, 1, { 0x02129, 0x00000 } },	// iiota
+			{ 8234, 5, 1, { 0x00133, 0x00000 } },	// ijlig
+			{ 8239, 5, 1, { 0x0012B, 0x00000 } },	// imacr
+			{ 8244, 5, 1, { 0x02111, 0x00000 } },	// image
+			{ 8249, 8, 1, { 0x02110, 0x00000 } },	// imagline
+			{ 8257, 8, 1, { 0x02111, 0x00000 } },	// imagpart
+			{ 8265, 5, 1, { 0x00131, 0x00000 } },	// imath
+			{ 8270, 4, 1, { 0x022B7, 0x00000 } },	// imof
+			{ 8274, 5, 1, { 0x001B5, 0x00000 } },	// imped
+			{ 8279, 2, 1, { 0x02208, 0x00000 } },	// in
+			{ 8281, 6, 1, { 0x02105, 0x00000 } },	// incare
+			{ 8287, 5, 1, { 0x0221E, 0x00000 } },	// infin
+			{ 8292, 8, 1, { 0x029DD, 0x00000 } },	// infintie
+			{ 8300, 6, 1, { 0x00131, 0x00000 } },	// inodot
+			{ 8306, 3, 1, { 0x0222B, 0x00000 } },	// int
+			{ 8309, 6, 1, { 0x022BA, 0x00000 } },	// intcal
+			{ 8315, 8, 1, { 0x02124, 0x00000 } },	// integers
+			{ 8323, 8, 1, { 0x022BA, 0x00000 } },	// intercal
+			{ 8331, 8, 1, { 0x02A17, 0x00000 } },	// intlarhk
+			{ 8339, 7, 1, { 0x02A3C, 0x00000 } },	// intprod
+			{ 8346, 4, 1, { 0x00451, 0x00000 } },	// iocy
+			{ 8350, 5, 1, { 0x0012F, 0x00000 } },	// iogon
+			{ 8355, 4, 1, { 0x1D55A, 0x00000 } },	// iopf
+			{ 8359, 4, 1, { 0x003B9, 0x00000 } },	// iota
+			{ 8363, 5, 1, { 0x02A3C, 0x00000 } },	// iprod
+			{ 8368, 6, 1, { 0x000BF, 0x00000 } },	// iquest
+			{ 8374, 4, 1, { 0x1D4BE, 0x00000 } },	// iscr
+			{ 8378, 4, 1, { 0x02208, 0x00000 } },	// isin
+			{ 8382, 5, 1, { 0x022F9, 0x00000 } },	// isinE
+			{ 8387, 7, 1, { 0x022F5, 0x00000 } },	// isindot
+			{ 8394, 5, 1, { 0x022F4, 0x00000 } },	// isins
+			{ 8399, 6, 1, { 0x022F3, 0x00000 } },	// isinsv
+			{ 8405, 5, 1, { 0x02208, 0x00000 } },	// isinv
+			{ 8410, 2, 1, { 0x02062, 0x00000 } },	// it
+			{ 8412, 6, 1, { 0x00129, 0x00000 } },	// itilde
+			{ 8418, 5, 1, { 0x00456, 0x00000 } },	// iukcy
+			{ 8423, 4, 1, { 0x000EF, 0x00000 } },	// iuml
+			{ 8427, 5, 1, { 0x00135, 0x00000 } },	// jcirc
+			{ 8432, 3, 1, { 0x00439, 0x00000 } },	// jcy
+			{ 8435, 3, 1, { 0x1D527, 0x00000 } },	// jfr
+			{ 8438, 5, 1, { 0x00237, 0x00000 } },	// jmath
+			{ 8443, 4, 1, { 0x1D55B, 0x00000 } },	// jopf
+			{ 8447, 4, 1, { 0x1D4BF, 0x00000 } },	// jscr
+			{ 8451, 6, 1, { 0x00458, 0x00000 } },	// jsercy
+			{ 8457, 5, 1, { 0x00454, 0x00000 } },	// jukcy
+			{ 8462, 5, 1, { 0x003BA, 0x00000 } },	// kappa
+			{ 8467, 6, 1, { 0x003F0, 0x00000 } },	// kappav
+			{ 8473, 6, 1, { 0x00137, 0x00000 } },	// kcedil
+			{ 8479, 3, 1, { 0x0043A, 0x00000 } },	// kcy
+			{ 8482, 3, 1, { 0x1D528, 0x00000 } },	// kfr
+			{ 8485, 6, 1, { 0x00138, 0x00000 } },	// kgreen
+			{ 8491, 4, 1, { 0x00445, 0x00000 } },	// khcy
+			{ 8495, 4, 1, { 0x0045C, 0x00000 } },	// kjcy
+			{ 8499, 4, 1, { 0x1D55C, 0x00000 } },	// kopf
+			{ 8503, 4, 1, { 0x1D4C0, 0x00000 } },	// kscr
+			{ 8507, 5, 1, { 0x021DA, 0x00000 } },	// lAarr
+			{ 8512, 4, 1, { 0x021D0, 0x00000 } },	// lArr
+			{ 8516, 6, 1, { 0x0291B, 0x00000 } },	// lAtail
+			{ 8522, 5, 1, { 0x0290E, 0x00000 } },	// lBarr
+			{ 8527, 2, 1, { 0x02266, 0x00000 } },	// lE
+			{ 8529, 3, 1, { 0x02A8B, 0x00000 } },	// lEg
+			{ 8532, 4, 1, { 0x02962, 0x00000 } },	// lHar
+			{ 8536, 6, 1, { 0x0013A, 0x00000 } },	// lacute
+			{ 8542, 8, 1, { 0x029B4, 0x00000 } },	// laemptyv
+			{ 8550, 6, 1, { 0x02112, 0x00000 } },	// lagran
+			{ 8556, 6, 1, { 0x003BB, 0x00000 } },	// lambda
+			{ 8562, 4, 1, { 0x027E8, 0x00000 } },	// lang
+			{ 8566, 5, 1, { 0x02991, 0x00000 } },	// langd
+			{ 8571, 6, 1, { 0x027E8, 0x00000 } },	// langle
+			{ 8577, 3, 1, { 0x02A85, 0x00000 } },	// lap
+			{ 8580, 5, 1, { 0x000AB, 0x00000 } },	// laquo
+			{ 8585, 4, 1, { 0x02190, 0x00000 } },	// larr
+			{ 8589, 5, 1, { 0x021E4, 0x00000 } },	// larrb
+			{ 8594, 7, 1, { 0x0291F, 0x00000 } },	// larrbfs
+			{ 8601, 6, 1, { 0x0291D, 0x00000 } },	// larrfs
+			{ 8607, 6, 1, { 0x021A9, 0x00000 } },	// larrhk
+			{ 8613, 6, 1, { 0x021AB, 0x00000 } },	// larrlp
+			{ 8619, 6, 1, { 0x02939, 0x00000 } },	// larrpl
+			{ 8625, 7, 1, { 0x02973, 0x00000 } },	// larrsim
+			{ 8632, 6, 1, { 0x021A2, 0x00000 } },	// larrtl
+			{ 8638, 3, 1, { 0x02AAB, 0x00000 } },	// lat
+			{ 8641, 6, 1, { 0x02919, 0x00000 } },	// latail
+			{ 8647, 4, 1, { 0x02AAD, 0x00000 } },	// late
+			{ 8651, 5, 2, { 0x02AAD, 0x0FE00 } },	// lates
+			{ 8656, 5, 1, { 0x0290C, 0x00000 } },	// lbarr
+			{ 8661, 5, 1, { 0x02772, 0x00000 } },	// lbbrk
+			{ 8666, 6, 1, { 0x0007B, 0x00000 } },	// lbrace
+			{ 8672, 6, 1, { 0x0005B, 0x00000 } },	// lbrack
+			{ 8678, 5, 1, { 0x0298B, 0x00000 } },	// lbrke
+			{ 8683, 7, 1, { 0x0298F, 0x00000 } },	// lbrksld
+			{ 8690, 7, 1, { 0x0298D, 0x00000 } },	// lbrkslu
+			{ 8697, 6, 1, { 0x0013E, 0x00000 } },	// lcaron
+			{ 8703, 6, 1, { 0x0013C, 0x00000 } },	// lcedil
+			{ 8709, 5, 1, { 0x02308, 0x00000 } },	// lceil
+			{ 8714, 4, 1, { 0x0007B, 0x00000 } },	// lcub
+			{ 8718, 3, 1, { 0x0043B, 0x00000 } },	// lcy
+			{ 8721, 4, 1, { 0x02936, 0x00000 } },	// ldca
+			{ 8725, 5, 1, { 0x0201C, 0x00000 } },	// ldquo
+			{ 8730, 6, 1, { 0x0201E, 0x00000 } },	// ldquor
+			{ 8736, 7, 1, { 0x02967, 0x00000 } },	// ldrdhar
+			{ 8743, 8, 1, { 0x0294B, 0x00000 } },	// ldrushar
+			{ 8751, 4, 1, { 0x021B2, 0x00000 } },	// ldsh
+			{ 8755, 2, 1, { 0x02264, 0x00000 } },	// le
+			{ 8757, 9, 1, { 0x02190, 0x00000 } },	// leftarrow
+			{ 8766, 13, 1, { 0x021A2, 0x00000 } },	// leftarrowtail
+			{ 8779, 15, 1, { 0x021BD, 0x00000 } },	// leftharpoondown
+			{ 8794, 13, 1, { 0x021BC, 0x00000 } },	// leftharpoonup
+			{ 8807, 14, 1, { 0x021C7, 0x00000 } },	// leftleftarrows
+			{ 8821, 14, 1, { 0x02194, 0x00000 } },	// leftrightarrow
+			{ 8835, 15, 1, { 0x021C6, 0x00000 } },	// leftrightarrows
+			{ 8850, 17, 1, { 0x021CB, 0x00000 } },	// leftrightharpoons
+			{ 8867, 19, 1, { 0x021AD, 0x00000 } },	// leftrightsquigarrow
+			{ 8886, 14, 1, { 0x022CB, 0x00000 } },	// leftthreetimes
+			{ 8900, 3, 1, { 0x022DA, 0x00000 } },	// leg
+			{ 8903, 3, 1, { 0x02264, 0x00000 } },	// leq
+			{ 8906, 4, 1, { 0x02266, 0x00000 } },	// leqq
+			{ 8910, 8, 1, { 0x02A7D, 0x00000 } },	// leqslant
+			{ 8918, 3, 1, { 0x02A7D, 0x00000 } },	// les
+			{ 8921, 5, 1, { 0x02AA8, 0x00000 } },	// lescc
+			{ 8926, 6, 1, { 0x02A7F, 0x00000 } },	// lesdot
+			{ 8932, 7, 1, { 0x02A81, 0x00000 } },	// lesdoto
+			{ 8939, 8, 1, { 0x02A83, 0x00000 } },	// lesdotor
+			{ 8947, 4, 2, { 0x022DA, 0x0FE00 } },	// lesg
+			{ 8951, 6, 1, { 0x02A93, 0x00000 } },	// lesges
+			{ 8957, 10, 1, { 0x02A85, 0x00000 } },	// lessapprox
+			{ 8967, 7, 1, { 0x022D6, 0x00000 } },	// lessdot
+			{ 8974, 9, 1, { 0x022DA, 0x00000 } },	// lesseqgtr
+			{ 8983, 10, 1, { 0x02A8B, 0x00000 } },	// lesseqqgtr
+			{ 8993, 7, 1, { 0x02276, 0x00000 } },	// lessgtr
+			{ 9000, 7, 1, { 0x02272, 0x00000 } },	// lesssim
+			{ 9007, 6, 1, { 0x0297C, 0x00000 } },	// lfisht
+			{ 9013, 6, 1, { 0x0230A, 0x00000 } },	// lfloor
+			{ 9019, 3, 1, { 0x1D529, 0x00000 } },	// lfr
+			{ 9022, 2, 1, { 0x02276, 0x00000 } },	// lg
+			{ 9024, 3, 1, { 0x02A91, 0x00000 } },	// lgE
+			{ 9027, 5, 1, { 0x021BD, 0x00000 } },	// lhard
+			{ 9032, 5, 1, { 0x021BC, 0x00000 } },	// lharu
+			{ 9037, 6, 1, { 0x0296A, 0x00000 } },	// lharul
+			{ 9043, 5, 1, { 0x02584, 0x00000 } },	// lhblk
+			{ 9048, 4, 1, { 0x00459, 0x00000 } },	// ljcy
+			{ 9052, 2, 1, { 0x0226A, 0x00000 } },	// ll
+			{ 9054, 5, 1, { 0x021C7, 0x00000 } },	// llarr
+			{ 9059, 8, 1, { 0x0231E, 0x00000 } },	// llcorner
+			{ 9067, 6, 1, { 0x0296B, 0x00000 } },	// llhard
+			{ 9073, 5, 1, { 0x025FA, 0x00000 } },	// lltri
+			{ 9078, 6, 1, { 0x00140, 0x00000 } },	// lmidot
+			{ 9084, 6, 1, { 0x023B0, 0x00000 } },	// lmoust
+			{ 9090, 10, 1, { 0x023B0, 0x00000 } },	// lmoustache
+			{ 9100, 3, 1, { 0x02268, 0x00000 } },	// lnE
+			{ 9103, 4, 1, { 0x02A89, 0x00000 } },	// lnap
+			{ 9107, 8, 1, { 0x02A89, 0x00000 } },	// lnapprox
+			{ 9115, 3, 1, { 0x02A87, 0x00000 } },	// lne
+			{ 9118, 4, 1, { 0x02A87, 0x00000 } },	// lneq
+			{ 9122, 5, 1, { 0x02268, 0x00000 } },	// lneqq
+			{ 9127, 5, 1, { 0x022E6, 0x00000 } },	// lnsim
+			{ 9132, 5, 1, { 0x027EC, 0x00000 } },	// loang
+			{ 9137, 5, 1, { 0x021FD, 0x00000 } },	// loarr
+			{ 9142, 5, 1, { 0x027E6, 0x00000 } },	// lobrk
+			{ 9147, 13, 1, { 0x027F5, 0x00000 } },	// longleftarrow
+			{ 9160, 18, 1, { 0x027F7, 0x00000 } },	// longleftrightarrow
+			{ 9178, 10, 1, { 0x027FC, 0x00000 } },	// longmapsto
+			{ 9188, 14, 1, { 0x027F6, 0x00000 } },	// longrightarrow
+			{ 9202, 13, 1, { 0x021AB, 0x00000 } },	// looparrowleft
+			{ 9215, 14, 1, { 0x021AC, 0x00000 } },	// looparrowright
+			{ 9229, 5, 1, { 0x02985, 0x00000 } },	// lopar
+			{ 9234, 4, 1, { 0x1D55D, 0x00000 } },	// lopf
+			{ 9238, 6, 1, { 0x02A2D, 0x00000 } },	// loplus
+			{ 9244, 7, 1, { 0x02A34, 0x00000 } },	// lotimes
+			{ 9251, 6, 1, { 0x02217, 0x00000 } },	// lowast
+			{ 9257, 6, 1, { 0x0005F, 0x00000 } },	// lowbar
+			{ 9263, 3, 1, { 0x025CA, 0x00000 } },	// loz
+			{ 9266, 7, 1, { 0x025CA, 0x00000 } },	// lozenge
+			{ 9273, 4, 1, { 0x029EB, 0x00000 } },	// lozf
+			{ 9277, 4, 1, { 0x00028, 0x00000 } },	// lpar
+			{ 9281, 6, 1, { 0x02993, 0x00000 } },	// lparlt
+			{ 9287, 5, 1, { 0x021C6, 0x00000 } },	// lrarr
+			{ 9292, 8, 1, { 0x0231F, 0x00000 } },	// lrcorner
+			{ 9300, 5, 1, { 0x021CB, 0x00000 } },	// lrhar
+			{ 9305, 6, 1, { 0x0296D, 0x00000 } },	// lrhard
+			{ 9311, 3, 1, { 0x0200E, 0x00000 } },	// lrm
+			{ 9314, 5, 1, { 0x022BF, 0x00000 } },	// lrtri
+			{ 9319, 6, 1, { 0x02039, 0x00000 } },	// lsaquo
+			{ 9325, 4, 1, { 0x1D4C1, 0x00000 } },	// lscr
+			{ 9329, 3, 1, { 0x021B0, 0x00000 } },	// lsh
+			{ 9332, 4, 1, { 0x02272, 0x00000 } },	// lsim
+			{ 9336, 5, 1, { 0x02A8D, 0x00000 } },	// lsime
+			{ 9341, 5, 1, { 0x02A8F, 0x00000 } },	// lsimg
+			{ 9346, 4, 1, { 0x0005B, 0x00000 } },	// lsqb
+			{ 9350, 5, 1, { 0x02018, 0x00000 } },	// lsquo
+			{ 9355, 6, 1, { 0x0201A, 0x00000 } },	// lsquor
+			{ 9361, 6, 1, { 0x00142, 0x00000 } },	// lstrok
+			{ 9367, 2, 1, { 0x0003C, 0x00000 } },	// lt
+			{ 9369, 4, 1, { 0x02AA6, 0x00000 } },	// ltcc
+			{ 9373, 5, 1, { 0x02A79, 0x00000 } },	// ltcir
+			{ 9378, 5, 1, { 0x022D6, 0x00000 } },	// ltdot
+			{ 9383, 6, 1, { 0x022CB, 0x00000 } },	// lthree
+			{ 9389, 6, 1, { 0x022C9, 0x00000 } },	// ltimes
+			{ 9395, 6, 1, { 0x02976, 0x00000 } },	// ltlarr
+			{ 9401, 7, 1, { 0x02A7B, 0x00000 } },	// ltquest
+			{ 9408, 6, 1, { 0x02996, 0x00000 } },	// ltrPar
+			{ 9414, 4, 1, { 0x025C3, 0x00000 } },	// ltri
+			{ 9418, 5, 1, { 0x022B4, 0x00000 } },	// ltrie
+			{ 9423, 5, 1, { 0x025C2, 0x00000 } },	// ltrif
+			{ 9428, 8, 1, { 0x0294A, 0x00000 } },	// lurdshar
+			{ 9436, 7, 1, { 0x02966, 0x00000 } },	// luruhar
+			{ 9443, 9, 2, { 0x02268, 0x0FE00 } },	// lvertneqq
+			{ 9452, 4, 2, { 0x02268, 0x0FE00 } },	// lvnE
+			{ 9456, 5, 1, { 0x0223A, 0x00000 } },	// mDDot
+			{ 9461, 4, 1, { 0x000AF, 0x00000 } },	// macr
+			{ 9465, 4, 1, { 0x02642, 0x00000 } },	// male
+			{ 9469, 4, 1, { 0x02720, 0x00000 } },	// malt
+			{ 9473, 7, 1, { 0x02720, 0x00000 } },	// maltese
+			{ 9480, 3, 1, { 0x021A6, 0x00000 } },	// map
+			{ 9483, 6, 1, { 0x021A6, 0x00000 } },	// mapsto
+			{ 9489, 10, 1, { 0x021A7, 0x00000 } },	// mapstodown
+			{ 9499, 10, 1, { 0x021A4, 0x00000 } },	// mapstoleft
+			{ 9509, 8, 1, { 0x021A5, 0x00000 } },	// mapstoup
+			{ 9517, 6, 1, { 0x025AE, 0x00000 } },	// marker
+			{ 9523, 6, 1, { 0x02A29, 0x00000 } },	// mcomma
+			{ 9529, 3, 1, { 0x0043C, 0x00000 } },	// mcy
+			{ 9532, 5, 1, { 0x02014, 0x00000 } },	// mdash
+			{ 9537, 13, 1, { 0x02221, 0x00000 } },	// measuredangle
+			{ 9550, 3, 1, { 0x1D52A, 0x00000 } },	// mfr
+			{ 9553, 3, 1, { 0x02127, 0x00000 } },	// mho
+			{ 9556, 5, 1, { 0x000B5, 0x00000 } },	// micro
+			{ 9561, 3, 1, { 0x02223, 0x00000 } },	// mid
+			{ 9564, 6, 1, { 0x0002A, 0x00000 } },	// midast
+			{ 9570, 6, 1, { 0x02AF0, 0x00000 } },	// midcir
+			{ 9576, 6, 1, { 0x000B7, 0x00000 } },	// middot
+			{ 9582, 5, 1, { 0x02212, 0x00000 } },	// minus
+			{ 9587, 6, 1, { 0x0229F, 0x00000 } },	// minusb
+			{ 9593, 6, 1, { 0x02238, 0x00000 } },	// minusd
+			{ 9599, 7, 1, { 0x02A2A, 0x00000 } },	// minusdu
+			{ 9606, 4, 1, { 0x02ADB, 0x00000 } },	// mlcp
+			{ 9610, 4, 1, { 0x02026, 0x00000 } },	// mldr
+			{ 9614, 6, 1, { 0x02213, 0x00000 } },	// mnplus
+			{ 9620, 6, 1, { 0x022A7, 0x00000 } },	// models
+			{ 9626, 4, 1, { 0x1D55E, 0x00000 } },	// mopf
+			{ 9630, 2, 1, { 0x02213, 0x00000 } },	// mp
+			{ 9632, 4, 1, { 0x1D4C2, 0x00000 } },	// mscr
+			{ 9636, 6, 1, { 0x0223E, 0x00000 } },	// mstpos
+			{ 9642, 2, 1, { 0x003BC, 0x00000 } },	// mu
+			{ 9644, 8, 1, { 0x022B8, 0x00000 } },	// multimap
+			{ 9652, 5, 1, { 0x022B8, 0x00000 } },	// mumap
+			{ 9657, 3, 2, { 0x022D9, 0x00338 } },	// nGg
+			{ 9660, 3, 2, { 0x0226B, 0x020D2 } },	// nGt
+			{ 9663, 4, 2, { 0x0226B, 0x00338 } },	// nGtv
+			{ 9667, 10, 1, { 0x021CD, 0x00000 } },	// nLeftarrow
+			{ 9677, 15, 1, { 0x021CE, 0x00000 } },	// nLeftrightarrow
+			{ 9692, 3, 2, { 0x022D8, 0x00338 } },	// nLl
+			{ 9695, 3, 2, { 0x0226A, 0x020D2 } },	// nLt
+			{ 9698, 4, 2, { 0x0226A, 0x00338 } },	// nLtv
+			{ 9702, 11, 1, { 0x021CF, 0x00000 } },	// nRightarrow
+			{ 9713, 6, 1, { 0x022AF, 0x00000 } },	// nVDash
+			{ 9719, 6, 1, { 0x022AE, 0x00000 } },	// nVdash
+			{ 9725, 5, 1, { 0x02207, 0x00000 } },	// nabla
+			{ 9730, 6, 1, { 0x00144, 0x00000 } },	// nacute
+			{ 9736, 4, 2, { 0x02220, 0x020D2 } },	// nang
+			{ 9740, 3, 1, { 0x02249, 0x00000 } },	// nap
+			{ 9743, 4, 2, { 0x02A70, 0x00338 } },	// napE
+			{ 9747, 5, 2, { 0x0224B, 0x00338 } },	// napid
+			{ 9752, 5, 1, { 0x00149, 0x00000 } },	// napos
+			{ 9757, 7, 1, { 0x02249, 0x00000 } },	// napprox
+			{ 9764, 5, 1, { 0x0266E, 0x00000 } },	// natur
+			{ 9769, 7, 1, { 0x0266E, 0x00000 } },	// natural
+			{ 9776, 8, 1, { 0x02115, 0x00000 } },	// naturals
+			{ 9784, 4, 1, { 0x00020, 0x00000 } },	// nbsp
+			{ 9788, 5, 2, { 0x0224E, 0x00338 } },	// nbump
+			{ 9793, 6, 2, { 0x0224F, 0x00338 } },	// nbumpe
+			{ 9799, 4, 1, { 0x02A43, 0x00000 } },	// ncap
+			{ 9803, 6, 1, { 0x00148, 0x00000 } },	// ncaron
+			{ 9809, 6, 1, { 0x00146, 0x00000 } },	// ncedil
+			{ 9815, 5, 1, { 0x02247, 0x00000 } },	// ncong
+			{ 9820, 8, 2, { 0x02A6D, 0x00338 } },	// ncongdot
+			{ 9828, 4, 1, { 0x02A42, 0x00000 } },	// ncup
+			{ 9832, 3, 1, { 0x0043D, 0x00000 } },	// ncy
+			{ 9835, 5, 1, { 0x02013, 0x00000 } },	// ndash
+			{ 9840, 2, 1, { 0x02260, 0x00000 } },	// ne
+			{ 9842, 5, 1, { 0x021D7, 0x00000 } },	// neArr
+			{ 9847, 6, 1, { 0x02924, 0x00000 } },	// nearhk
+			{ 9853, 5, 1, { 0x02197, 0x00000 } },	// nearr
+			{ 9858, 7, 1, { 0x02197, 0x00000 } },	// nearrow
+			{ 9865, 5, 2, { 0x02250, 0x00338 } },	// nedot
+			{ 9870, 6, 1, { 0x02262, 0x00000 } },	// nequiv
+			{ 9876, 6, 1, { 0x02928, 0x00000 } },	// nesear
+			{ 9882, 5, 2, { 0x02242, 0x00338 } },	// nesim
+			{ 9887, 6, 1, { 0x02204, 0x00000 } },	// nexist
+			{ 9893, 7, 1, { 0x02204, 0x00000 } },	// nexists
+			{ 9900, 3, 1, { 0x1D52B, 0x00000 } },	// nfr
+			{ 9903, 3, 2, { 0x02267, 0x00338 } },	// ngE
+			{ 9906, 3, 1, { 0x02271, 0x00000 } },	// nge
+			{ 9909, 4, 1, { 0x02271, 0x00000 } },	// ngeq
+			{ 9913, 5, 2, { 0x02267, 0x00338 } },	// ngeqq
+			{ 9918, 9, 2, { 0x02A7E, 0x00338 } },	// ngeqslant
+			{ 9927, 4, 2, { 0x02A7E, 0x00338 } },	// nges
+			{ 9931, 5, 1, { 0x02275, 0x00000 } },	// ngsim
+			{ 9936, 3, 1, { 0x0226F, 0x00000 } },	// ngt
+			{ 9939, 4, 1, { 0x0226F, 0x00000 } },	// ngtr
+			{ 9943, 5, 1, { 0x021CE, 0x00000 } },	// nhArr
+			{ 9948, 5, 1, { 0x021AE, 0x00000 } },	// nharr
+			{ 9953, 5, 1, { 0x02AF2, 0x00000 } },	// nhpar
+			{ 9958, 2, 1, { 0x0220B, 0x00000 } },	// ni
+			{ 9960, 3, 1, { 0x022FC, 0x00000 } },	// nis
+			{ 9963, 4, 1, { 0x022FA, 0x00000 } },	// nisd
+			{ 9967, 3, 1, { 0x0220B, 0x00000 } },	// niv
+			{ 9970, 4, 1, { 0x0045A, 0x00000 } },	// njcy
+			{ 9974, 5, 1, { 0x021CD, 0x00000 } },	// nlArr
+			{ 9979, 3, 2, { 0x02266, 0x00338 } },	// nlE
+			{ 9982, 5, 1, { 0x0219A, 0x00000 } },	// nlarr
+			{ 9987, 4, 1, { 0x02025, 0x00000 } },	// nldr
+			{ 9991, 3, 1, { 0x02270, 0x00000 } },	// nle
+			{ 9994, 10, 1, { 0x0219A, 0x00000 } },	// nleftarrow
+			{ 10004, 15, 1, { 0x021AE, 0x00000 } },	// nleftrightarrow
+			{ 10019, 4, 1, { 0x02270, 0x00000 } },	// nleq
+			{ 10023, 5, 2, { 0x02266, 0x00338 } },	// nleqq
+			{ 10028, 9, 2, { 0x02A7D, 0x00338 } },	// nleqslant
+			{ 10037, 4, 2, { 0x02A7D, 0x00338 } },	// nles
+			{ 10041, 5, 1, { 0x0226E, 0x00000 } },	// nless
+			{ 10046, 5, 1, { 0x02274, 0x00000 } },	// nlsim
+			{ 10051, 3, 1, { 0x0226E, 0x00000 } },	// nlt
+			{ 10054, 5, 1, { 0x022EA, 0x00000 } },	// nltri
+			{ 10059, 6, 1, { 0x022EC, 0x00000 } },	// nltrie
+			{ 10065, 4, 1, { 0x02224, 0x00000 } },	// nmid
+			{ 10069, 4, 1, { 0x1D55F, 0x00000 } },	// nopf
+			{ 10073, 3, 1, { 0x000AC, 0x00000 } },	// not
+			{ 10076, 5, 1, { 0x02209, 0x00000 } },	// notin
+			{ 10081, 6, 2, { 0x022F9, 0x00338 } },	// notinE
+			{ 10087, 8, 2, { 0x022F5, 0x00338 } },	// notindot
+			{ 10095, 7, 1, { 0x02209, 0x00000 } },	// notinva
+			{ 10102, 7, 1, { 0x022F7, 0x00000 } },	// notinvb
+			{ 10109, 7, 1, { 0x022F6, 0x00000 } },	// notinvc
+			{ 10116, 5, 1, { 0x0220C, 0x00000 } },	// notni
+			{ 10121, 7, 1, { 0x0220C, 0x00000 } },	// notniva
+			{ 10128, 7, 1, { 0x022FE, 0x00000 } },	// notnivb
+			{ 10135, 7, 1, { 0x022FD, 0x00000 } },	// notnivc
+			{ 10142, 4, 1, { 0x02226, 0x00000 } },	// npar
+			{ 10146, 9, 1, { 0x02226, 0x00000 } },	// nparallel
+			{ 10155, 6, 2, { 0x02AFD, 0x020E5 } },	// nparsl
+			{ 10161, 5, 2, { 0x02202, 0x00338 } },	// npart
+			{ 10166, 7, 1, { 0x02A14, 0x00000 } },	// npolint
+			{ 10173, 3, 1, { 0x02280, 0x00000 } },	// npr
+			{ 10176, 6, 1, { 0x022E0, 0x00000 } },	// nprcue
+			{ 10182, 4, 2, { 0x02AAF, 0x00338 } },	// npre
+			{ 10186, 5, 1, { 0x02280, 0x00000 } },	// nprec
+			{ 10191, 7, 2, { 0x02AAF, 0x00338 } },	// npreceq
+			{ 10198, 5, 1, { 0x021CF, 0x00000 } },	// nrArr
+			{ 10203, 5, 1, { 0x0219B, 0x00000 } },	// nrarr
+			{ 10208, 6, 2, { 0x02933, 0x00338 } },	// nrarrc
+			{ 10214, 6, 2, { 0x0219D, 0x00338 } },	// nrarrw
+			{ 10220, 11, 1, { 0x0219B, 0x00000 } },	// nrightarrow
+			{ 10231, 5, 1, { 0x022EB, 0x00000 } },	// nrtri
+			{ 10236, 6, 1, { 0x022ED, 0x00000 } },	// nrtrie
+			{ 10242, 3, 1, { 0x02281, 0x00000 } },	// nsc
+			{ 10245, 6, 1, { 0x022E1, 0x00000 } },	// nsccue
+			{ 10251, 4, 2, { 0x02AB0, 0x00338 } },	// nsce
+			{ 10255, 4, 1, { 0x1D4C3, 0x00000 } },	// nscr
+			{ 10259, 9, 1, { 0x02224, 0x00000 } },	// nshortmid
+			{ 10268, 14, 1, { 0x02226, 0x00000 } },	// nshortparallel
+			{ 10282, 4, 1, { 0x02241, 0x00000 } },	// nsim
+			{ 10286, 5, 1, { 0x02244, 0x00000 } },	// nsime
+			{ 10291, 6, 1, { 0x02244, 0x00000 } },	// nsimeq
+			{ 10297, 5, 1, { 0x02224, 0x00000 } },	// nsmid
+			{ 10302, 5, 1, { 0x02226, 0x00000 } },	// nspar
+			{ 10307, 7, 1, { 0x022E2, 0x00000 } },	// nsqsube
+			{ 10314, 7, 1, { 0x022E3, 0x00000 } },	// nsqsupe
+			{ 10321, 4, 1, { 0x02284, 0x00000 } },	// nsub
+			{ 10325, 5, 2, { 0x02AC5, 0x00338 } },	// nsubE
+			{ 10330, 5, 1, { 0x02288, 0x00000 } },	// nsube
+			{ 10335, 7, 2, { 0x02282, 0x020D2 } },	// nsubset
+			{ 10342, 9, 1, { 0x02288, 0x00000 } },	// nsubseteq
+			{ 10351, 10, 2, { 0x02AC5, 0x00338 } },	// nsubseteqq
+			{ 10361, 5, 1, { 0x02281, 0x00000 } },	// nsucc
+			{ 10366, 7, 2, { 0x02AB0, 0x00338 } },	// nsucceq
+			{ 10373, 4, 1, { 0x02285, 0x00000 } },	// nsup
+			{ 10377, 5, 2, { 0x02AC6, 0x00338 } },	// nsupE
+			{ 10382, 5, 1, { 0x02289, 0x00000 } },	// nsupe
+			{ 10387, 7, 2, { 0x02283, 0x020D2 } },	// nsupset
+			{ 10394, 9, 1, { 0x02289, 0x00000 } },	// nsupseteq
+			{ 10403, 10, 2, { 0x02AC6, 0x00338 } },	// nsupseteqq
+			{ 10413, 4, 1, { 0x02279, 0x00000 } },	// ntgl
+			{ 10417, 6, 1, { 0x000F1, 0x00000 } },	// ntilde
+			{ 10423, 4, 1, { 0x02278, 0x00000 } },	// ntlg
+			{ 10427, 13, 1, { 0x022EA, 0x00000 } },	// ntriangleleft
+			{ 10440, 15, 1, { 0x022EC, 0x00000 } },	// ntrianglelefteq
+			{ 10455, 14, 1, { 0x022EB, 0x00000 } },	// ntriangleright
+			{ 10469, 16, 1, { 0x022ED, 0x00000 } },	// ntrianglerighteq
+			{ 10485, 2, 1, { 0x003BD, 0x00000 } },	// nu
+			{ 10487, 3, 1, { 0x00023, 0x00000 } },	// num
+			{ 10490, 6, 1, { 0x02116, 0x00000 } },	// numero
+			{ 10496, 5, 1, { 0x02007, 0x00000 } },	// numsp
+			{ 10501, 6, 1, { 0x022AD, 0x00000 } },	// nvDash
+			{ 10507, 6, 1, { 0x02904, 0x00000 } },	// nvHarr
+			{ 10513, 4, 2, { 0x0224D, 0x020D2 } },	// nvap
+			{ 10517, 6, 1, { 0x022AC, 0x00000 } },	// nvdash
+			{ 10523, 4, 2, { 0x02265, 0x020D2 } },	// nvge
+			{ 10527, 4, 2, { 0x0003E, 0x020D2 } },	// nvgt
+			{ 10531, 7, 1, { 0x029DE, 0x00000 } },	// nvinfin
+			{ 10538, 6, 1, { 0x02902, 0x00000 } },	// nvlArr
+			{ 10544, 4, 2, { 0x02264, 0x020D2 } },	// nvle
+			{ 10548, 4, 2, { 0x0003C, 0x020D2 } },	// nvlt
+			{ 10552, 7, 2, { 0x022B4, 0x020D2 } },	// nvltrie
+			{ 10559, 6, 1, { 0x02903, 0x00000 } },	// nvrArr
+			{ 10565, 7, 2, { 0x022B5, 0x020D2 } },	// nvrtrie
+			{ 10572, 5, 2, { 0x0223C, 0x020D2 } },	// nvsim
+			{ 10577, 5, 1, { 0x021D6, 0x00000 } },	// nwArr
+			{ 10582, 6, 1, { 0x02923, 0x00000 } },	// nwarhk
+			{ 10588, 5, 1, { 0x02196, 0x00000 } },	// nwarr
+			{ 10593, 7, 1, { 0x02196, 0x00000 } },	// nwarrow
+			{ 10600, 6, 1, { 0x02927, 0x00000 } },	// nwnear
+			{ 10606, 2, 1, { 0x024C8, 0x00000 } },	// oS
+			{ 10608, 6, 1, { 0x000F3, 0x00000 } },	// oacute
+			{ 10614, 4, 1, { 0x0229B, 0x00000 } },	// oast
+			{ 10618, 4, 1, { 0x0229A, 0x00000 } },	// ocir
+			{ 10622, 5, 1, { 0x000F4, 0x00000 } },	// ocirc
+			{ 10627, 3, 1, { 0x0043E, 0x00000 } },	// ocy
+			{ 10630, 5, 1, { 0x0229D, 0x00000 } },	// odash
+			{ 10635, 6, 1, { 0x00151, 0x00000 } },	// odblac
+			{ 10641, 4, 1, { 0x02A38, 0x00000 } },	// odiv
+			{ 10645, 4, 1, { 0x02299, 0x00000 } },	// odot
+			{ 10649, 6, 1, { 0x029BC, 0x00000 } },	// odsold
+			{ 10655, 5, 1, { 0x00153, 0x00000 } },	// oelig
+			{ 10660, 5, 1, { 0x029BF, 0x00000 } },	// ofcir
+			{ 10665, 3, 1, { 0x1D52C, 0x00000 } },	// ofr
+			{ 10668, 4, 1, { 0x002DB, 0x00000 } },	// ogon
+			{ 10672, 6, 1, { 0x000F2, 0x00000 } },	// ograve
+			{ 10678, 3, 1, { 0x029C1, 0x00000 } },	// ogt
+			{ 10681, 5, 1, { 0x029B5, 0x00000 } },	// ohbar
+			{ 10686, 3, 1, { 0x003A9, 0x00000 } },	// ohm
+			{ 10689, 4, 1, { 0x0222E, 0x00000 } },	// oint
+			{ 10693, 5, 1, { 0x021BA, 0x00000 } },	// olarr
+			{ 10698, 5, 1, { 0x029BE, 0x00000 } },	// olcir
+			{ 10703, 7, 1, { 0x029BB, 0x00000 } },	// olcross
+			{ 10710, 5, 1, { 0x0203E, 0x00000 } },	// oline
+			{ 10715, 3, 1, { 0x029C0, 0x00000 } },	// olt
+			{ 10718, 5, 1, { 0x0014D, 0x00000 } },	// omacr
+			{ 10723, 5, 1, { 0x003C9, 0x00000 } },	// omega
+			{ 10728, 7, 1, { 0x003BF, 0x00000 } },	// omicron
+			{ 10735, 4, 1, { 0x029B6, 0x00000 } },	// omid
+			{ 10739, 6, 1, { 0x02296, 0x00000 } },	// ominus
+			{ 10745, 4, 1, { 0x1D560, 0x00000 } },	// oopf
+			{ 10749, 4, 1, { 0x029B7, 0x00000 } },	// opar
+			{ 10753, 5, 1, { 0x029B9, 0x00000 } },	// operp
+			{ 10758, 5, 1, { 0x02295, 0x00000 } },	// oplus
+			{ 10763, 2, 1, { 0x02228, 0x00000 } },	// or
+			{ 10765, 5, 1, { 0x021BB, 0x00000 } },	// orarr
+			{ 10770, 3, 1, { 0x02A5D, 0x00000 } },	// ord
+			{ 10773, 5, 1, { 0x02134, 0x00000 } },	// order
+			{ 10778, 7, 1, { 0x02134, 0x00000 } },	// orderof
+			{ 10785, 4, 1, { 0x000AA, 0x00000 } },	// ordf
+			{ 10789, 4, 1, { 0x000BA, 0x00000 } },	// ordm
+			{ 10793, 6, 1, { 0x022B6, 0x00000 } },	// origof
+			{ 10799, 4, 1, { 0x02A56, 0x00000 } },	// oror
+			{ 10803, 7, 1, { 0x02A57, 0x00000 } },	// orslope
+			{ 10810, 3, 1, { 0x02A5B, 0x00000 } },	// orv
+			{ 10813, 4, 1, { 0x02134, 0x00000 } },	// oscr
+			{ 10817, 6, 1, { 0x000F8, 0x00000 } },	// oslash
+			{ 10823, 4, 1, { 0x02298, 0x00000 } },	// osol
+			{ 10827, 6, 1, { 0x000F5, 0x00000 } },	// otilde
+			{ 10833, 6, 1, { 0x02297, 0x00000 } },	// otimes
+			{ 10839, 8, 1, { 0x02A36, 0x00000 } },	// otimesas
+			{ 10847, 4, 1, { 0x000F6, 0x00000 } },	// ouml
+			{ 10851, 5, 1, { 0x0233D, 0x00000 } },	// ovbar
+			{ 10856, 3, 1, { 0x02225, 0x00000 } },	// par
+			{ 10859, 4, 1, { 0x000B6, 0x00000 } },	// para
+			{ 10863, 8, 1, { 0x02225, 0x00000 } },	// parallel
+			{ 10871, 6, 1, { 0x02AF3, 0x00000 } },	// parsim
+			{ 10877, 5, 1, { 0x02AFD, 0x00000 } },	// parsl
+			{ 10882, 4, 1, { 0x02202, 0x00000 } },	// part
+			{ 10886, 3, 1, { 0x0043F, 0x00000 } },	// pcy
+			{ 10889, 6, 1, { 0x00025, 0x00000 } },	// percnt
+			{ 10895, 6, 1, { 0x0002E, 0x00000 } },	// period
+			{ 10901, 6, 1, { 0x02030, 0x00000 } },	// permil
+			{ 10907, 4, 1, { 0x022A5, 0x00000 } },	// perp
+			{ 10911, 7, 1, { 0x02031, 0x00000 } },	// pertenk
+			{ 10918, 3, 1, { 0x1D52D, 0x00000 } },	// pfr
+			{ 10921, 3, 1, { 0x003C6, 0x00000 } },	// phi
+			{ 10924, 4, 1, { 0x003D5, 0x00000 } },	// phiv
+			{ 10928, 6, 1, { 0x02133, 0x00000 } },	// phmmat
+			{ 10934, 5, 1, { 0x0260E, 0x00000 } },	// phone
+			{ 10939, 2, 1, { 0x003C0, 0x00000 } },	// pi
+			{ 10941, 9, 1, { 0x022D4, 0x00000 } },	// pitchfork
+			{ 10950, 3, 1, { 0x003D6, 0x00000 } },	// piv
+			{ 10953, 6, 1, { 0x0210F, 0x00000 } },	// planck
+			{ 10959, 7, 1, { 0x0210E, 0x00000 } },	// planckh
+			{ 10966, 6, 1, { 0x0210F, 0x00000 } },	// plankv
+			{ 10972, 4, 1, { 0x0002B, 0x00000 } },	// plus
+			{ 10976, 8, 1, { 0x02A23, 0x00000 } },	// plusacir
+			{ 10984, 5, 1, { 0x0229E, 0x00000 } },	// plusb
+			{ 10989, 7, 1, { 0x02A22, 0x00000 } },	// pluscir
+			{ 10996, 6, 1, { 0x02214, 0x00000 } },	// plusdo
+			{ 11002, 6, 1, { 0x02A25, 0x00000 } },	// plusdu
+			{ 11008, 5, 1, { 0x02A72, 0x00000 } },	// pluse
+			{ 11013, 6, 1, { 0x000B1, 0x00000 } },	// plusmn
+			{ 11019, 7, 1, { 0x02A26, 0x00000 } },	// plussim
+			{ 11026, 7, 1, { 0x02A27, 0x00000 } },	// plustwo
+			{ 11033, 2, 1, { 0x000B1, 0x00000 } },	// pm
+			{ 11035, 8, 1, { 0x02A15, 0x00000 } },	// pointint
+			{ 11043, 4, 1, { 0x1D561, 0x00000 } },	// popf
+			{ 11047, 5, 1, { 0x000A3, 0x00000 } },	// pound
+			{ 11052, 2, 1, { 0x0227A, 0x00000 } },	// pr
+			{ 11054, 3, 1, { 0x02AB3, 0x00000 } },	// prE
+			{ 11057, 4, 1, { 0x02AB7, 0x00000 } },	// prap
+			{ 11061, 5, 1, { 0x0227C, 0x00000 } },	// prcue
+			{ 11066, 3, 1, { 0x02AAF, 0x00000 } },	// pre
+			{ 11069, 4, 1, { 0x0227A, 0x00000 } },	// prec
+			{ 11073, 10, 1, { 0x02AB7, 0x00000 } },	// precapprox
+			{ 11083, 11, 1, { 0x0227C, 0x00000 } },	// preccurlyeq
+			{ 11094, 6, 1, { 0x02AAF, 0x00000 } },	// preceq
+			{ 11100, 11, 1, { 0x02AB9, 0x00000 } },	// precnapprox
+			{ 11111, 8, 1, { 0x02AB5, 0x00000 } },	// precneqq
+			{ 11119, 8, 1, { 0x022E8, 0x00000 } },	// precnsim
+			{ 11127, 7, 1, { 0x0227E, 0x00000 } },	// precsim
+			{ 11134, 5, 1, { 0x02032, 0x00000 } },	// prime
+			{ 11139, 6, 1, { 0x02119, 0x00000 } },	// primes
+			{ 11145, 4, 1, { 0x02AB5, 0x00000 } },	// prnE
+			{ 11149, 5, 1, { 0x02AB9, 0x00000 } },	// prnap
+			{ 11154, 6, 1, { 0x022E8, 0x00000 } },	// prnsim
+			{ 11160, 4, 1, { 0x0220F, 0x00000 } },	// prod
+			{ 11164, 8, 1, { 0x0232E, 0x00000 } },	// profalar
+			{ 11172, 8, 1, { 0x02312, 0x00000 } },	// profline
+			{ 11180, 8, 1, { 0x02313, 0x00000 } },	// profsurf
+			{ 11188, 4, 1, { 0x0221D, 0x00000 } },	// prop
+			{ 11192, 6, 1, { 0x0221D, 0x00000 } },	// propto
+			{ 11198, 5, 1, { 0x0227E, 0x00000 } },	// prsim
+			{ 11203, 6, 1, { 0x022B0, 0x00000 } },	// prurel
+			{ 11209, 4, 1, { 0x1D4C5, 0x00000 } },	// pscr
+			{ 11213, 3, 1, { 0x003C8, 0x00000 } },	// psi
+			{ 11216, 6, 1, { 0x02008, 0x00000 } },	// puncsp
+			{ 11222, 3, 1, { 0x1D52E, 0x00000 } },	// qfr
+			{ 11225, 4, 1, { 0x02A0C, 0x00000 } },	// qint
+			{ 11229, 4, 1, { 0x1D562, 0x00000 } },	// qopf
+			{ 11233, 6, 1, { 0x02057, 0x00000 } },	// qprime
+			{ 11239, 4, 1, { 0x1D4C6, 0x00000 } },	// qscr
+			{ 11243, 11, 1, { 0x0210D, 0x00000 } },	// quaternions
+			{ 11254, 7, 1, { 0x02A16, 0x00000 } },	// quatint
+			{ 11261, 5, 1, { 0x0003F, 0x00000 } },	// quest
+			{ 11266, 7, 1, { 0x0225F, 0x00000 } },	// questeq
+			{ 11273, 4, 1, { 0x00022, 0x00000 } },	// quot
+			{ 11277, 5, 1, { 0x021DB, 0x00000 } },	// rAarr
+			{ 11282, 4, 1, { 0x021D2, 0x00000 } },	// rArr
+			{ 11286, 6, 1, { 0x0291C, 0x00000 } },	// rAtail
+			{ 11292, 5, 1, { 0x0290F, 0x00000 } },	// rBarr
+			{ 11297, 4, 1, { 0x02964, 0x00000 } },	// rHar
+			{ 11301, 4, 2, { 0x0223D, 0x00331 } },	// race
+			{ 11305, 6, 1, { 0x00155, 0x00000 } },	// racute
+			{ 11311, 5, 1, { 0x0221A, 0x00000 } },	// radic
+			{ 11316, 8, 1, { 0x029B3, 0x00000 } },	// raemptyv
+			{ 11324, 4, 1, { 0x027E9, 0x00000 } },	// rang
+			{ 11328, 5, 1, { 0x02992, 0x00000 } },	// rangd
+			{ 11333, 5, 1, { 0x029A5, 0x00000 } },	// range
+			{ 11338, 6, 1, { 0x027E9, 0x00000 } },	// rangle
+			{ 11344, 5, 1, { 0x000BB, 0x00000 } },	// raquo
+			{ 11349, 4, 1, { 0x02192, 0x00000 } },	// rarr
+			{ 11353, 6, 1, { 0x02975, 0x00000 } },	// rarrap
+			{ 11359, 5, 1, { 0x021E5, 0x00000 } },	// rarrb
+			{ 11364, 7, 1, { 0x02920, 0x00000 } },	// rarrbfs
+			{ 11371, 5, 1, { 0x02933, 0x00000 } },	// rarrc
+			{ 11376, 6, 1, { 0x0291E, 0x00000 } },	// rarrfs
+			{ 11382, 6, 1, { 0x021AA, 0x00000 } },	// rarrhk
+			{ 11388, 6, 1, { 0x021AC, 0x00000 } },	// rarrlp
+			{ 11394, 6, 1, { 0x02945, 0x00000 } },	// rarrpl
+			{ 11400, 7, 1, { 0x02974, 0x00000 } },	// rarrsim
+			{ 11407, 6, 1, { 0x021A3, 0x00000 } },	// rarrtl
+			{ 11413, 5, 1, { 0x0219D, 0x00000 } },	// rarrw
+			{ 11418, 6, 1, { 0x0291A, 0x00000 } },	// ratail
+			{ 11424, 5, 1, { 0x02236, 0x00000 } },	// ratio
+			{ 11429, 9, 1, { 0x0211A, 0x00000 } },	// rationals
+			{ 11438, 5, 1, { 0x0290D, 0x00000 } },	// rbarr
+			{ 11443, 5, 1, { 0x02773, 0x00000 } },	// rbbrk
+			{ 11448, 6, 1, { 0x0007D, 0x00000 } },	// rbrace
+			{ 11454, 6, 1, { 0x0005D, 0x00000 } },	// rbrack
+			{ 11460, 5, 1, { 0x0298C, 0x00000 } },	// rbrke
+			{ 11465, 7, 1, { 0x0298E, 0x00000 } },	// rbrksld
+			{ 11472, 7, 1, { 0x02990, 0x00000 } },	// rbrkslu
+			{ 11479, 6, 1, { 0x00159, 0x00000 } },	// rcaron
+			{ 11485, 6, 1, { 0x00157, 0x00000 } },	// rcedil
+			{ 11491, 5, 1, { 0x02309, 0x00000 } },	// rceil
+			{ 11496, 4, 1, { 0x0007D, 0x00000 } },	// rcub
+			{ 11500, 3, 1, { 0x00440, 0x00000 } },	// rcy
+			{ 11503, 4, 1, { 0x02937, 0x00000 } },	// rdca
+			{ 11507, 7, 1, { 0x02969, 0x00000 } },	// rdldhar
+			{ 11514, 5, 1, { 0x0201D, 0x00000 } },	// rdquo
+			{ 11519, 6, 1, { 0x0201D, 0x00000 } },	// rdquor
+			{ 11525, 4, 1, { 0x021B3, 0x00000 } },	// rdsh
+			{ 11529, 4, 1, { 0x0211C, 0x00000 } },	// real
+			{ 11533, 7, 1, { 0x0211B, 0x00000 } },	// realine
+			{ 11540, 8, 1, { 0x0211C, 0x00000 } },	// realpart
+			{ 11548, 5, 1, { 0x0211D, 0x00000 } },	// reals
+			{ 11553, 4, 1, { 0x025AD, 0x00000 } },	// rect
+			{ 11557, 3, 1, { 0x000AE, 0x00000 } },	// reg
+			{ 11560, 6, 1, { 0x0297D, 0x00000 } },	// rfisht
+			{ 11566, 6, 1, { 0x0230B, 0x00000 } },	// rfloor
+			{ 11572, 3, 1, { 0x1D52F, 0x00000 } },	// rfr
+			{ 11575, 5, 1, { 0x021C1, 0x00000 } },	// rhard
+			{ 11580, 5, 1, { 0x021C0, 0x00000 } },	// rharu
+			{ 11585, 6, 1, { 0x0296C, 0x00000 } },	// rharul
+			{ 11591, 3, 1, { 0x003C1, 0x00000 } },	// rho
+			{ 11594, 4, 1, { 0x003F1, 0x00000 } },	// rhov
+			{ 11598, 10, 1, { 0x02192, 0x00000 } },	// rightarrow
+			{ 11608, 14, 1, { 0x021A3, 0x00000 } },	// rightarrowtail
+			{ 11622, 16, 1, { 0x021C1, 0x00000 } },	// rightharpoondown
+			{ 11638, 14, 1, { 0x021C0, 0x00000 } },	// rightharpoonup
+			{ 11652, 15, 1, { 0x021C4, 0x00000 } },	// rightleftarrows
+			{ 11667, 17, 1, { 0x021CC, 0x00000 } },	// rightleftharpoons
+			{ 11684, 16, 1, { 0x021C9, 0x00000 } },	// rightrightarrows
+			{ 11700, 15, 1, { 0x0219D, 0x00000 } },	// rightsquigarrow
+			{ 11715, 15, 1, { 0x022CC, 0x00000 } },	// rightthreetimes
+			{ 11730, 4, 1, { 0x002DA, 0x00000 } },	// ring
+			{ 11734, 12, 1, { 0x02253, 0x00000 } },	// risingdotseq
+			{ 11746, 5, 1, { 0x021C4, 0x00000 } },	// rlarr
+			{ 11751, 5, 1, { 0x021CC, 0x00000 } },	// rlhar
+			{ 11756, 3, 1, { 0x0200F, 0x00000 } },	// rlm
+			{ 11759, 6, 1, { 0x023B1, 0x00000 } },	// rmoust
+			{ 11765, 10, 1, { 0x023B1, 0x00000 } },	// rmoustache
+			{ 11775, 5, 1, { 0x02AEE, 0x00000 } },	// rnmid
+			{ 11780, 5, 1, { 0x027ED, 0x00000 } },	// roang
+			{ 11785, 5, 1, { 0x021FE, 0x00000 } },	// roarr
+			{ 11790, 5, 1, { 0x027E7, 0x00000 } },	// robrk
+			{ 11795, 5, 1, { 0x02986, 0x00000 } },	// ropar
+			{ 11800, 4, 1, { 0x1D563, 0x00000 } },	// ropf
+			{ 11804, 6, 1, { 0x02A2E, 0x00000 } },	// roplus
+			{ 11810, 7, 1, { 0x02A35, 0x00000 } },	// rotimes
+			{ 11817, 4, 1, { 0x00029, 0x00000 } },	// rpar
+			{ 11821, 6, 1, { 0x02994, 0x00000 } },	// rpargt
+			{ 11827, 8, 1, { 0x02A12, 0x00000 } },	// rppolint
+			{ 11835, 5, 1, { 0x021C9, 0x00000 } },	// rrarr
+			{ 11840, 6, 1, { 0x0203A, 0x00000 } },	// rsaquo
+			{ 11846, 4, 1, { 0x1D4C7, 0x00000 } },	// rscr
+			{ 11850, 3, 1, { 0x021B1, 0x00000 } },	// rsh
+			{ 11853, 4, 1, { 0x0005D, 0x00000 } },	// rsqb
+			{ 11857, 5, 1, { 0x02019, 0x00000 } },	// rsquo
+			{ 11862, 6, 1, { 0x02019, 0x00000 } },	// rsquor
+			{ 11868, 6, 1, { 0x022CC, 0x00000 } },	// rthree
+			{ 11874, 6, 1, { 0x022CA, 0x00000 } },	// rtimes
+			{ 11880, 4, 1, { 0x025B9, 0x00000 } },	// rtri
+			{ 11884, 5, 1, { 0x022B5, 0x00000 } },	// rtrie
+			{ 11889, 5, 1, { 0x025B8, 0x00000 } },	// rtrif
+			{ 11894, 8, 1, { 0x029CE, 0x00000 } },	// rtriltri
+			{ 11902, 7, 1, { 0x02968, 0x00000 } },	// ruluhar
+			{ 11909, 2, 1, { 0x0211E, 0x00000 } },	// rx
+			{ 11911, 6, 1, { 0x0015B, 0x00000 } },	// sacute
+			{ 11917, 5, 1, { 0x0201A, 0x00000 } },	// sbquo
+			{ 11922, 2, 1, { 0x0227B, 0x00000 } },	// sc
+			{ 11924, 3, 1, { 0x02AB4, 0x00000 } },	// scE
+			{ 11927, 4, 1, { 0x02AB8, 0x00000 } },	// scap
+			{ 11931, 6, 1, { 0x00161, 0x00000 } },	// scaron
+			{ 11937, 5, 1, { 0x0227D, 0x00000 } },	// sccue
+			{ 11942, 3, 1, { 0x02AB0, 0x00000 } },	// sce
+			{ 11945, 6, 1, { 0x0015F, 0x00000 } },	// scedil
+			{ 11951, 5, 1, { 0x0015D, 0x00000 } },	// scirc
+			{ 11956, 4, 1, { 0x02AB6, 0x00000 } },	// scnE
+			{ 11960, 5, 1, { 0x02ABA, 0x00000 } },	// scnap
+			{ 11965, 6, 1, { 0x022E9, 0x00000 } },	// scnsim
+			{ 11971, 8, 1, { 0x02A13, 0x00000 } },	// scpolint
+			{ 11979, 5, 1, { 0x0227F, 0x00000 } },	// scsim
+			{ 11984, 3, 1, { 0x00441, 0x00000 } },	// scy
+			{ 11987, 4, 1, { 0x022C5, 0x00000 } },	// sdot
+			{ 11991, 5, 1, { 0x022A1, 0x00000 } },	// sdotb
+			{ 11996, 5, 1, { 0x02A66, 0x00000 } },	// sdote
+			{ 12001, 5, 1, { 0x021D8, 0x00000 } },	// seArr
+			{ 12006, 6, 1, { 0x02925, 0x00000 } },	// searhk
+			{ 12012, 5, 1, { 0x02198, 0x00000 } },	// searr
+			{ 12017, 7, 1, { 0x02198, 0x00000 } },	// searrow
+			{ 12024, 4, 1, { 0x000A7, 0x00000 } },	// sect
+			{ 12028, 4, 1, { 0x0003B, 0x00000 } },	// semi
+			{ 12032, 6, 1, { 0x02929, 0x00000 } },	// seswar
+			{ 12038, 8, 1, { 0x02216, 0x00000 } },	// setminus
+			{ 12046, 5, 1, { 0x02216, 0x00000 } },	// setmn
+			{ 12051, 4, 1, { 0x02736, 0x00000 } },	// sext
+			{ 12055, 3, 1, { 0x1D530, 0x00000 } },	// sfr
+			{ 12058, 6, 1, { 0x02322, 0x00000 } },	// sfrown
+			{ 12064, 5, 1, { 0x0266F, 0x00000 } },	// sharp
+			{ 12069, 6, 1, { 0x00449, 0x00000 } },	// shchcy
+			{ 12075, 4, 1, { 0x00448, 0x00000 } },	// shcy
+			{ 12079, 8, 1, { 0x02223, 0x00000 } },	// shortmid
+			{ 12087, 13, 1, { 0x02225, 0x00000 } },	// shortparallel
+			{ 12100, 3, 1, { 0x000AD, 0x00000 } },	// shy
+			{ 12103, 5, 1, { 0x003C3, 0x00000 } },	// sigma
+			{ 12108, 6, 1, { 0x003C2, 0x00000 } },	// sigmaf
+			{ 12114, 6, 1, { 0x003C2, 0x00000 } },	// sigmav
+			{ 12120, 3, 1, { 0x0223C, 0x00000 } },	// sim
+			{ 12123, 6, 1, { 0x02A6A, 0x00000 } },	// simdot
+			{ 12129, 4, 1, { 0x02243, 0x00000 } },	// sime
+			{ 12133, 5, 1, { 0x02243, 0x00000 } },	// simeq
+			{ 12138, 4, 1, { 0x02A9E, 0x00000 } },	// simg
+			{ 12142, 5, 1, { 0x02AA0, 0x00000 } },	// simgE
+			{ 12147, 4, 1, { 0x02A9D, 0x00000 } },	// siml
+			{ 12151, 5, 1, { 0x02A9F, 0x00000 } },	// simlE
+			{ 12156, 5, 1, { 0x02246, 0x00000 } },	// simne
+			{ 12161, 7, 1, { 0x02A24, 0x00000 } },	// simplus
+			{ 12168, 7, 1, { 0x02972, 0x00000 } },	// simrarr
+			{ 12175, 5, 1, { 0x02190, 0x00000 } },	// slarr
+			{ 12180, 13, 1, { 0x02216, 0x00000 } },	// smallsetminus
+			{ 12193, 6, 1, { 0x02A33, 0x00000 } },	// smashp
+			{ 12199, 8, 1, { 0x029E4, 0x00000 } },	// smeparsl
+			{ 12207, 4, 1, { 0x02223, 0x00000 } },	// smid
+			{ 12211, 5, 1, { 0x02323, 0x00000 } },	// smile
+			{ 12216, 3, 1, { 0x02AAA, 0x00000 } },	// smt
+			{ 12219, 4, 1, { 0x02AAC, 0x00000 } },	// smte
+			{ 12223, 5, 2, { 0x02AAC, 0x0FE00 } },	// smtes
+			{ 12228, 6, 1, { 0x0044C, 0x00000 } },	// softcy
+			{ 12234, 3, 1, { 0x0002F, 0x00000 } },	// sol
+			{ 12237, 4, 1, { 0x029C4, 0x00000 } },	// solb
+			{ 12241, 6, 1, { 0x0233F, 0x00000 } },	// solbar
+			{ 12247, 4, 1, { 0x1D564, 0x00000 } },	// sopf
+			{ 12251, 6, 1, { 0x02660, 0x00000 } },	// spades
+			{ 12257, 9, 1, { 0x02660, 0x00000 } },	// spadesuit
+			{ 12266, 4, 1, { 0x02225, 0x00000 } },	// spar
+			{ 12270, 5, 1, { 0x02293, 0x00000 } },	// sqcap
+			{ 12275, 6, 2, { 0x02293, 0x0FE00 } },	// sqcaps
+			{ 12281, 5, 1, { 0x02294, 0x00000 } },	// sqcup
+			{ 12286, 6, 2, { 0x02294, 0x0FE00 } },	// sqcups
+			{ 12292, 5, 1, { 0x0228F, 0x00000 } },	// sqsub
+			{ 12297, 6, 1, { 0x02291, 0x00000 } },	// sqsube
+			{ 12303, 8, 1, { 0x0228F, 0x00000 } },	// sqsubset
+			{ 12311, 10, 1, { 0x02291, 0x00000 } },	// sqsubseteq
+			{ 12321, 5, 1, { 0x02290, 0x00000 } },	// sqsup
+			{ 12326, 6, 1, { 0x02292, 0x00000 } },	// sqsupe
+			{ 12332, 8, 1, { 0x02290, 0x00000 } },	// sqsupset
+			{ 12340, 10, 1, { 0x02292, 0x00000 } },	// sqsupseteq
+			{ 12350, 3, 1, { 0x025A1, 0x00000 } },	// squ
+			{ 12353, 6, 1, { 0x025A1, 0x00000 } },	// square
+			{ 12359, 6, 1, { 0x025AA, 0x00000 } },	// squarf
+			{ 12365, 4, 1, { 0x025AA, 0x00000 } },	// squf
+			{ 12369, 5, 1, { 0x02192, 0x00000 } },	// srarr
+			{ 12374, 4, 1, { 0x1D4C8, 0x00000 } },	// sscr
+			{ 12378, 6, 1, { 0x02216, 0x00000 } },	// ssetmn
+			{ 12384, 6, 1, { 0x02323, 0x00000 } },	// ssmile
+			{ 12390, 6, 1, { 0x022C6, 0x00000 } },	// sstarf
+			{ 12396, 4, 1, { 0x02606, 0x00000 } },	// star
+			{ 12400, 5, 1, { 0x02605, 0x00000 } },	// starf
+			{ 12405, 15, 1, { 0x003F5, 0x00000 } },	// straightepsilon
+			{ 12420, 11, 1, { 0x003D5, 0x00000 } },	// straightphi
+			{ 12431, 5, 1, { 0x000AF, 0x00000 } },	// strns
+			{ 12436, 3, 1, { 0x02282, 0x00000 } },	// sub
+			{ 12439, 4, 1, { 0x02AC5, 0x00000 } },	// subE
+			{ 12443, 6, 1, { 0x02ABD, 0x00000 } },	// subdot
+			{ 12449, 4, 1, { 0x02286, 0x00000 } },	// sube
+			{ 12453, 7, 1, { 0x02AC3, 0x00000 } },	// subedot
+			{ 12460, 7, 1, { 0x02AC1, 0x00000 } },	// submult
+			{ 12467, 5, 1, { 0x02ACB, 0x00000 } },	// subnE
+			{ 12472, 5, 1, { 0x0228A, 0x00000 } },	// subne
+			{ 12477, 7, 1, { 0x02ABF, 0x00000 } },	// subplus
+			{ 12484, 7, 1, { 0x02979, 0x00000 } },	// subrarr
+			{ 12491, 6, 1, { 0x02282, 0x00000 } },	// subset
+			{ 12497, 8, 1, { 0x02286, 0x00000 } },	// subseteq
+			{ 12505, 9, 1, { 0x02AC5, 0x00000 } },	// subseteqq
+			{ 12514, 9, 1, { 0x0228A, 0x00000 } },	// subsetneq
+			{ 12523, 10, 1, { 0x02ACB, 0x00000 } },	// subsetneqq
+			{ 12533, 6, 1, { 0x02AC7, 0x00000 } },	// subsim
+			{ 12539, 6, 1, { 0x02AD5, 0x00000 } },	// subsub
+			{ 12545, 6, 1, { 0x02AD3, 0x00000 } },	// subsup
+			{ 12551, 4, 1, { 0x0227B, 0x00000 } },	// succ
+			{ 12555, 10, 1, { 0x02AB8, 0x00000 } },	// succapprox
+			{ 12565, 11, 1, { 0x0227D, 0x00000 } },	// succcurlyeq
+			{ 12576, 6, 1, { 0x02AB0, 0x00000 } },	// succeq
+			{ 12582, 11, 1, { 0x02ABA, 0x00000 } },	// succnapprox
+			{ 12593, 8, 1, { 0x02AB6, 0x00000 } },	// succneqq
+			{ 12601, 8, 1, { 0x022E9, 0x00000 } },	// succnsim
+			{ 12609, 7, 1, { 0x0227F, 0x00000 } },	// succsim
+			{ 12616, 3, 1, { 0x02211, 0x00000 } },	// sum
+			{ 12619, 4, 1, { 0x0266A, 0x00000 } },	// sung
+			{ 12623, 3, 1, { 0x02283, 0x00000 } },	// sup
+			{ 12626, 4, 1, { 0x000B9, 0x00000 } },	// sup1
+			{ 12630, 4, 1, { 0x000B2, 0x00000 } },	// sup2
+			{ 12634, 4, 1, { 0x000B3, 0x00000 } },	// sup3
+			{ 12638, 4, 1, { 0x02AC6, 0x00000 } },	// supE
+			{ 12642, 6, 1, { 0x02ABE, 0x00000 } },	// supdot
+			{ 12648, 7, 1, { 0x02AD8, 0x00000 } },	// supdsub
+			{ 12655, 4, 1, { 0x02287, 0x00000 } },	// supe
+			{ 12659, 7, 1, { 0x02AC4, 0x00000 } },	// supedot
+			{ 12666, 7, 1, { 0x027C9, 0x00000 } },	// suphsol
+			{ 12673, 7, 1, { 0x02AD7, 0x00000 } },	// suphsub
+			{ 12680, 7, 1, { 0x0297B, 0x00000 } },	// suplarr
+			{ 12687, 7, 1, { 0x02AC2, 0x00000 } },	// supmult
+			{ 12694, 5, 1, { 0x02ACC, 0x00000 } },	// supnE
+			{ 12699, 5, 1, { 0x0228B, 0x00000 } },	// supne
+			{ 12704, 7, 1, { 0x02AC0, 0x00000 } },	// supplus
+			{ 12711, 6, 1, { 0x02283, 0x00000 } },	// supset
+			{ 12717, 8, 1, { 0x02287, 0x00000 } },	// supseteq
+			{ 12725, 9, 1, { 0x02AC6, 0x00000 } },	// supseteqq
+			{ 12734, 9, 1, { 0x0228B, 0x00000 } },	// supsetneq
+			{ 12743, 10, 1, { 0x02ACC, 0x00000 } },	// supsetneqq
+			{ 12753, 6, 1, { 0x02AC8, 0x00000 } },	// supsim
+			{ 12759, 6, 1, { 0x02AD4, 0x00000 } },	// supsub
+			{ 12765, 6, 1, { 0x02AD6, 0x00000 } },	// supsup
+			{ 12771, 5, 1, { 0x021D9, 0x00000 } },	// swArr
+			{ 12776, 6, 1, { 0x02926, 0x00000 } },	// swarhk
+			{ 12782, 5, 1, { 0x02199, 0x00000 } },	// swarr
+			{ 12787, 7, 1, { 0x02199, 0x00000 } },	// swarrow
+			{ 12794, 6, 1, { 0x0292A, 0x00000 } },	// swnwar
+			{ 12800, 5, 1, { 0x000DF, 0x00000 } },	// szlig
+			{ 12805, 6, 1, { 0x02316, 0x00000 } },	// target
+			{ 12811, 3, 1, { 0x003C4, 0x00000 } },	// tau
+			{ 12814, 4, 1, { 0x023B4, 0x00000 } },	// tbrk
+			{ 12818, 6, 1, { 0x00165, 0x00000 } },	// tcaron
+			{ 12824, 6, 1, { 0x00163, 0x00000 } },	// tcedil
+			{ 12830, 3, 1, { 0x00442, 0x00000 } },	// tcy
+			{ 12833, 4, 1, { 0x020DB, 0x00000 } },	// tdot
+			{ 12837, 6, 1, { 0x02315, 0x00000 } },	// telrec
+			{ 12843, 3, 1, { 0x1D531, 0x00000 } },	// tfr
+			{ 12846, 6, 1, { 0x02234, 0x00000 } },	// there4
+			{ 12852, 9, 1, { 0x02234, 0x00000 } },	// therefore
+			{ 12861, 5, 1, { 0x003B8, 0x00000 } },	// theta
+			{ 12866, 8, 1, { 0x003D1, 0x00000 } },	// thetasym
+			{ 12874, 6, 1, { 0x003D1, 0x00000 } },	// thetav
+			{ 12880, 11, 1, { 0x02248, 0x00000 } },	// thickapprox
+			{ 12891, 8, 1, { 0x0223C, 0x00000 } },	// thicksim
+			{ 12899, 6, 1, { 0x02009, 0x00000 } },	// thinsp
+			{ 12905, 5, 1, { 0x02248, 0x00000 } },	// thkap
+			{ 12910, 6, 1, { 0x0223C, 0x00000 } },	// thksim
+			{ 12916, 5, 1, { 0x000FE, 0x00000 } },	// thorn
+			{ 12921, 5, 1, { 0x002DC, 0x00000 } },	// tilde
+			{ 12926, 5, 1, { 0x000D7, 0x00000 } },	// times
+			{ 12931, 6, 1, { 0x022A0, 0x00000 } },	// timesb
+			{ 12937, 8, 1, { 0x02A31, 0x00000 } },	// timesbar
+			{ 12945, 6, 1, { 0x02A30, 0x00000 } },	// timesd
+			{ 12951, 4, 1, { 0x0222D, 0x00000 } },	// tint
+			{ 12955, 4, 1, { 0x02928, 0x00000 } },	// toea
+			{ 12959, 3, 1, { 0x022A4, 0x00000 } },	// top
+			{ 12962, 6, 1, { 0x02336, 0x00000 } },	// topbot
+			{ 12968, 6, 1, { 0x02AF1, 0x00000 } },	// topcir
+			{ 12974, 4, 1, { 0x1D565, 0x00000 } },	// topf
+			{ 12978, 7, 1, { 0x02ADA, 0x00000 } },	// topfork
+			{ 12985, 4, 1, { 0x02929, 0x00000 } },	// tosa
+			{ 12989, 6, 1, { 0x02034, 0x00000 } },	// tprime
+			{ 12995, 5, 1, { 0x02122, 0x00000 } },	// trade
+			{ 13000, 8, 1, { 0x025B5, 0x00000 } },	// triangle
+			{ 13008, 12, 1, { 0x025BF, 0x00000 } },	// triangledown
+			{ 13020, 12, 1, { 0x025C3, 0x00000 } },	// triangleleft
+			{ 13032, 14, 1, { 0x022B4, 0x00000 } },	// trianglelefteq
+			{ 13046, 9, 1, { 0x0225C, 0x00000 } },	// triangleq
+			{ 13055, 13, 1, { 0x025B9, 0x00000 } },	// triangleright
+			{ 13068, 15, 1, { 0x022B5, 0x00000 } },	// trianglerighteq
+			{ 13083, 6, 1, { 0x025EC, 0x00000 } },	// tridot
+			{ 13089, 4, 1, { 0x0225C, 0x00000 } },	// trie
+			{ 13093, 8, 1, { 0x02A3A, 0x00000 } },	// triminus
+			{ 13101, 7, 1, { 0x02A39, 0x00000 } },	// triplus
+			{ 13108, 5, 1, { 0x029CD, 0x00000 } },	// trisb
+			{ 13113, 7, 1, { 0x02A3B, 0x00000 } },	// tritime
+			{ 13120, 8, 1, { 0x023E2, 0x00000 } },	// trpezium
+			{ 13128, 4, 1, { 0x1D4C9, 0x00000 } },	// tscr
+			{ 13132, 4, 1, { 0x00446, 0x00000 } },	// tscy
+			{ 13136, 5, 1, { 0x0045B, 0x00000 } },	// tshcy
+			{ 13141, 6, 1, { 0x00167, 0x00000 } },	// tstrok
+			{ 13147, 5, 1, { 0x0226C, 0x00000 } },	// twixt
+			{ 13152, 16, 1, { 0x0219E, 0x00000 } },	// twoheadleftarrow
+			{ 13168, 17, 1, { 0x021A0, 0x00000 } },	// twoheadrightarrow
+			{ 13185, 4, 1, { 0x021D1, 0x00000 } },	// uArr
+			{ 13189, 4, 1, { 0x02963, 0x00000 } },	// uHar
+			{ 13193, 6, 1, { 0x000FA, 0x00000 } },	// uacute
+			{ 13199, 4, 1, { 0x02191, 0x00000 } },	// uarr
+			{ 13203, 5, 1, { 0x0045E, 0x00000 } },	// ubrcy
+			{ 13208, 6, 1, { 0x0016D, 0x00000 } },	// ubreve
+			{ 13214, 5, 1, { 0x000FB, 0x00000 } },	// ucirc
+			{ 13219, 3, 1, { 0x00443, 0x00000 } },	// ucy
+			{ 13222, 5, 1, { 0x021C5, 0x00000 } },	// udarr
+			{ 13227, 6, 1, { 0x00171, 0x00000 } },	// udblac
+			{ 13233, 5, 1, { 0x0296E, 0x00000 } },	// udhar
+			{ 13238, 6, 1, { 0x0297E, 0x00000 } },	// ufisht
+			{ 13244, 3, 1, { 0x1D532, 0x00000 } },	// ufr
+			{ 13247, 6, 1, { 0x000F9, 0x00000 } },	// ugrave
+			{ 13253, 5, 1, { 0x021BF, 0x00000 } },	// uharl
+			{ 13258, 5, 1, { 0x021BE, 0x00000 } },	// uharr
+			{ 13263, 5, 1, { 0x02580, 0x00000 } },	// uhblk
+			{ 13268, 6, 1, { 0x0231C, 0x00000 } },	// ulcorn
+			{ 13274, 8, 1, { 0x0231C, 0x00000 } },	// ulcorner
+			{ 13282, 6, 1, { 0x0230F, 0x00000 } },	// ulcrop
+			{ 13288, 5, 1, { 0x025F8, 0x00000 } },	// ultri
+			{ 13293, 5, 1, { 0x0016B, 0x00000 } },	// umacr
+			{ 13298, 3, 1, { 0x000A8, 0x00000 } },	// uml
+			{ 13301, 5, 1, { 0x00173, 0x00000 } },	// uogon
+			{ 13306, 4, 1, { 0x1D566, 0x00000 } },	// uopf
+			{ 13310, 7, 1, { 0x02191, 0x00000 } },	// uparrow
+			{ 13317, 11, 1, { 0x02195, 0x00000 } },	// updownarrow
+			{ 13328, 13, 1, { 0x021BF, 0x00000 } },	// upharpoonleft
+			{ 13341, 14, 1, { 0x021BE, 0x00000 } },	// upharpoonright
+			{ 13355, 5, 1, { 0x0228E, 0x00000 } },	// uplus
+			{ 13360, 4, 1, { 0x003C5, 0x00000 } },	// upsi
+			{ 13364, 5, 1, { 0x003D2, 0x00000 } },	// upsih
+			{ 13369, 7, 1, { 0x003C5, 0x00000 } },	// upsilon
+			{ 13376, 10, 1, { 0x021C8, 0x00000 } },	// upuparrows
+			{ 13386, 6, 1, { 0x0231D, 0x00000 } },	// urcorn
+			{ 13392, 8, 1, { 0x0231D, 0x00000 } },	// urcorner
+			{ 13400, 6, 1, { 0x0230E, 0x00000 } },	// urcrop
+			{ 13406, 5, 1, { 0x0016F, 0x00000 } },	// uring
+			{ 13411, 5, 1, { 0x025F9, 0x00000 } },	// urtri
+			{ 13416, 4, 1, { 0x1D4CA, 0x00000 } },	// uscr
+			{ 13420, 5, 1, { 0x022F0, 0x00000 } },	// utdot
+			{ 13425, 6, 1, { 0x00169, 0x00000 } },	// utilde
+			{ 13431, 4, 1, { 0x025B5, 0x00000 } },	// utri
+			{ 13435, 5, 1, { 0x025B4, 0x00000 } },	// utrif
+			{ 13440, 5, 1, { 0x021C8, 0x00000 } },	// uuarr
+			{ 13445, 4, 1, { 0x000FC, 0x00000 } },	// uuml
+			{ 13449, 7, 1, { 0x029A7, 0x00000 } },	// uwangle
+			{ 13456, 4, 1, { 0x021D5, 0x00000 } },	// vArr
+			{ 13460, 4, 1, { 0x02AE8, 0x00000 } },	// vBar
+			{ 13464, 5, 1, { 0x02AE9, 0x00000 } },	// vBarv
+			{ 13469, 5, 1, { 0x022A8, 0x00000 } },	// vDash
+			{ 13474, 6, 1, { 0x0299C, 0x00000 } },	// vangrt
+			{ 13480, 10, 1, { 0x003F5, 0x00000 } },	// varepsilon
+			{ 13490, 8, 1, { 0x003F0, 0x00000 } },	// varkappa
+			{ 13498, 10, 1, { 0x02205, 0x00000 } },	// varnothing
+			{ 13508, 6, 1, { 0x003D5, 0x00000 } },	// varphi
+			{ 13514, 5, 1, { 0x003D6, 0x00000 } },	// varpi
+			{ 13519, 9, 1, { 0x0221D, 0x00000 } },	// varpropto
+			{ 13528, 4, 1, { 0x02195, 0x00000 } },	// varr
+			{ 13532, 6, 1, { 0x003F1, 0x00000 } },	// varrho
+			{ 13538, 8, 1, { 0x003C2, 0x00000 } },	// varsigma
+			{ 13546, 12, 2, { 0x0228A, 0x0FE00 } },	// varsubsetneq
+			{ 13558, 13, 2, { 0x02ACB, 0x0FE00 } },	// varsubsetneqq
+			{ 13571, 12, 2, { 0x0228B, 0x0FE00 } },	// varsupsetneq
+			{ 13583, 13, 2, { 0x02ACC, 0x0FE00 } },	// varsupsetneqq
+			{ 13596, 8, 1, { 0x003D1, 0x00000 } },	// vartheta
+			{ 13604, 15, 1, { 0x022B2, 0x00000 } },	// vartriangleleft
+			{ 13619, 16, 1, { 0x022B3, 0x00000 } },	// vartriangleright
+			{ 13635, 3, 1, { 0x00432, 0x00000 } },	// vcy
+			{ 13638, 5, 1, { 0x022A2, 0x00000 } },	// vdash
+			{ 13643, 3, 1, { 0x02228, 0x00000 } },	// vee
+			{ 13646, 6, 1, { 0x022BB, 0x00000 } },	// veebar
+			{ 13652, 5, 1, { 0x0225A, 0x00000 } },	// veeeq
+			{ 13657, 6, 1, { 0x022EE, 0x00000 } },	// vellip
+			{ 13663, 6, 1, { 0x0007C, 0x00000 } },	// verbar
+			{ 13669, 4, 1, { 0x0007C, 0x00000 } },	// vert
+			{ 13673, 3, 1, { 0x1D533, 0x00000 } },	// vfr
+			{ 13676, 5, 1, { 0x022B2, 0x00000 } },	// vltri
+			{ 13681, 5, 2, { 0x02282, 0x020D2 } },	// vnsub
+			{ 13686, 5, 2, { 0x02283, 0x020D2 } },	// vnsup
+			{ 13691, 4, 1, { 0x1D567, 0x00000 } },	// vopf
+			{ 13695, 5, 1, { 0x0221D, 0x00000 } },	// vprop
+			{ 13700, 5, 1, { 0x022B3, 0x00000 } },	// vrtri
+			{ 13705, 4, 1, { 0x1D4CB, 0x00000 } },	// vscr
+			{ 13709, 6, 2, { 0x02ACB, 0x0FE00 } },	// vsubnE
+			{ 13715, 6, 2, { 0x0228A, 0x0FE00 } },	// vsubne
+			{ 13721, 6, 2, { 0x02ACC, 0x0FE00 } },	// vsupnE
+			{ 13727, 6, 2, { 0x0228B, 0x0FE00 } },	// vsupne
+			{ 13733, 7, 1, { 0x0299A, 0x00000 } },	// vzigzag
+			{ 13740, 5, 1, { 0x00175, 0x00000 } },	// wcirc
+			{ 13745, 6, 1, { 0x02A5F, 0x00000 } },	// wedbar
+			{ 13751, 5, 1, { 0x02227, 0x00000 } },	// wedge
+			{ 13756, 6, 1, { 0x02259, 0x00000 } },	// wedgeq
+			{ 13762, 6, 1, { 0x02118, 0x00000 } },	// weierp
+			{ 13768, 3, 1, { 0x1D534, 0x00000 } },	// wfr
+			{ 13771, 4, 1, { 0x1D568, 0x00000 } },	// wopf
+			{ 13775, 2, 1, { 0x02118, 0x00000 } },	// wp
+			{ 13777, 2, 1, { 0x02240, 0x00000 } },	// wr
+			{ 13779, 6, 1, { 0x02240, 0x00000 } },	// wreath
+			{ 13785, 4, 1, { 0x1D4CC, 0x00000 } },	// wscr
+			{ 13789, 4, 1, { 0x022C2, 0x00000 } },	// xcap
+			{ 13793, 5, 1, { 0x025EF, 0x00000 } },	// xcirc
+			{ 13798, 4, 1, { 0x022C3, 0x00000 } },	// xcup
+			{ 13802, 5, 1, { 0x025BD, 0x00000 } },	// xdtri
+			{ 13807, 3, 1, { 0x1D535, 0x00000 } },	// xfr
+			{ 13810, 5, 1, { 0x027FA, 0x00000 } },	// xhArr
+			{ 13815, 5, 1, { 0x027F7, 0x00000 } },	// xharr
+			{ 13820, 2, 1, { 0x003BE, 0x00000 } },	// xi
+			{ 13822, 5, 1, { 0x027F8, 0x00000 } },	// xlArr
+			{ 13827, 5, 1, { 0x027F5, 0x00000 } },	// xlarr
+			{ 13832, 4, 1, { 0x027FC, 0x00000 } },	// xmap
+			{ 13836, 4, 1, { 0x022FB, 0x00000 } },	// xnis
+			{ 13840, 5, 1, { 0x02A00, 0x00000 } },	// xodot
+			{ 13845, 4, 1, { 0x1D569, 0x00000 } },	// xopf
+			{ 13849, 6, 1, { 0x02A01, 0x00000 } },	// xoplus
+			{ 13855, 6, 1, { 0x02A02, 0x00000 } },	// xotime
+			{ 13861, 5, 1, { 0x027F9, 0x00000 } },	// xrArr
+			{ 13866, 5, 1, { 0x027F6, 0x00000 } },	// xrarr
+			{ 13871, 4, 1, { 0x1D4CD, 0x00000 } },	// xscr
+			{ 13875, 6, 1, { 0x02A06, 0x00000 } },	// xsqcup
+			{ 13881, 6, 1, { 0x02A04, 0x00000 } },	// xuplus
+			{ 13887, 5, 1, { 0x025B3, 0x00000 } },	// xutri
+			{ 13892, 4, 1, { 0x022C1, 0x00000 } },	// xvee
+			{ 13896, 6, 1, { 0x022C0, 0x00000 } },	// xwedge
+			{ 13902, 6, 1, { 0x000FD, 0x00000 } },	// yacute
+			{ 13908, 4, 1, { 0x0044F, 0x00000 } },	// yacy
+			{ 13912, 5, 1, { 0x00177, 0x00000 } },	// ycirc
+			{ 13917, 3, 1, { 0x0044B, 0x00000 } },	// ycy
+			{ 13920, 3, 1, { 0x000A5, 0x00000 } },	// yen
+			{ 13923, 3, 1, { 0x1D536, 0x00000 } },	// yfr
+			{ 13926, 4, 1, { 0x00457, 0x00000 } },	// yicy
+			{ 13930, 4, 1, { 0x1D56A, 0x00000 } },	// yopf
+			{ 13934, 4, 1, { 0x1D4CE, 0x00000 } },	// yscr
+			{ 13938, 4, 1, { 0x0044E, 0x00000 } },	// yucy
+			{ 13942, 4, 1, { 0x000FF, 0x00000 } },	// yuml
+			{ 13946, 6, 1, { 0x0017A, 0x00000 } },	// zacute
+			{ 13952, 6, 1, { 0x0017E, 0x00000 } },	// zcaron
+			{ 13958, 3, 1, { 0x00437, 0x00000 } },	// zcy
+			{ 13961, 4, 1, { 0x0017C, 0x00000 } },	// zdot
+			{ 13965, 6, 1, { 0x02128, 0x00000 } },	// zeetrf
+			{ 13971, 4, 1, { 0x003B6, 0x00000 } },	// zeta
+			{ 13975, 3, 1, { 0x1D537, 0x00000 } },	// zfr
+			{ 13978, 4, 1, { 0x00436, 0x00000 } },	// zhcy
+			{ 13982, 7, 1, { 0x021DD, 0x00000 } },	// zigrarr
+			{ 13989, 4, 1, { 0x1D56B, 0x00000 } },	// zopf
+			{ 13993, 4, 1, { 0x1D4CF, 0x00000 } },	// zscr
+			{ 13997, 3, 1, { 0x0200D, 0x00000 } },	// zwj
+			{ 14000, 4, 1, { 0x0200C, 0x00000 } },	// zwnj
+		};
+
+		inline constexpr std::uint16_t bucket_seeds[bucket_count] =
+		{
+			2, 0, 4, 4, 0, 0, 0, 2, 0, 0, 3, 3, 1, 3, 2, 4,
+			2, 4, 9, 0, 3, 1, 0, 0, 8, 0, 3, 3, 4, 2, 0, 0,
+			3, 1, 4, 0, 6, 11, 1, 8, 0, 2, 1, 2, 9, 2, 10, 6,
+			4, 1, 6, 1, 0, 0, 0, 3, 0, 8, 2, 0, 1, 0, 1, 10,
+			11, 0, 4, 6, 7, 6, 2, 0, 1, 9, 0, 2, 1, 0, 2, 1,
+			4, 4, 0, 0, 2, 2, 2, 0, 4, 0, 1, 2, 5, 0, 3, 4,
+			0, 14, 1, 2, 3, 0, 1, 0, 6, 13, 3, 9, 3, 0, 0, 5,
+			1, 0, 1, 3, 2, 1, 2, 6, 0, 0, 0, 1, 0, 0, 2, 0,
+			0, 5, 1, 0, 0, 0, 0, 2, 0, 2, 0, 11, 0, 6, 4, 6,
+			0, 2, 0, 0, 2, 0, 17, 1, 2, 4, 3, 2, 0, 0, 2, 1,
+			1, 0, 3, 8, 3, 2, 2, 0, 1, 0, 0, 4, 6, 3, 3, 0,
+			0, 1, 4, 5, 0, 3, 0, 2, 2, 10, 4, 1, 2, 1, 4, 0,
+			4, 3, 1, 10, 0, 6, 1, 2, 0, 1, 2, 12, 2, 1, 14, 0,
+			2, 3, 1, 1, 9, 2, 6, 5, 0, 5, 0, 0, 1, 0, 1, 6,
+			15, 0, 4, 8, 9, 0, 0, 0, 8, 1, 1, 2, 3, 7, 1, 7,
+			7, 2, 6, 4, 7, 1, 1, 8, 1, 2, 2, 2, 0, 1, 5, 1,
+			2, 3, 16, 1, 0, 2, 1, 1, 0, 1, 11, 13, 0, 1, 5, 5,
+			2, 7, 3, 3, 0, 3, 0, 0, 0, 3, 0, 1, 4, 2, 11, 0,
+			0, 15, 0, 1, 1, 0, 0, 0, 2, 0, 6, 9, 0, 0, 1, 3,
+			0, 0, 2, 3, 33, 1, 4, 1, 0, 14, 2, 6, 5, 4, 1, 12,
+			0, 1, 7, 3, 1, 5, 0, 0, 1, 8, 8, 7, 3, 2, 2, 1,
+			12, 6, 0, 1, 2, 1, 1, 3, 5, 0, 0, 0, 1, 3, 8, 0,
+			0, 0, 2, 1, 0, 6, 11, 0, 1, 5, 3, 0, 19, 3, 2, 0,
+			5, 2, 0, 0, 0, 3, 4, 2, 1, 0, 2, 1, 5, 0, 1, 2,
+			9, 3, 1, 1, 1, 6, 8, 5, 6, 4, 10, 11, 0, 8, 0, 1,
+			3, 8, 10, 13, 0, 4, 10, 7, 1, 4, 2, 2, 1, 2, 10, 0,
+			6, 1, 3, 7, 1, 15, 5, 16, 1, 6, 2, 0, 1, 4, 5, 0,
+			0, 0, 3, 3, 3, 29, 31, 17, 4, 7, 3, 0, 9, 1, 4, 1,
+			0, 5, 5, 1, 2, 3, 0, 0, 5, 4, 0, 2, 1, 4, 0, 3,
+			9, 15, 5, 1, 17, 0, 2, 0, 4, 0, 0, 0, 0, 2, 18, 1,
+			0, 1, 1, 16, 1, 4, 3, 4, 16, 17, 10, 9, 15, 4, 5, 2,
+			29, 1, 2, 3, 0, 33, 7, 1, 1, 1, 0, 0, 0, 0, 2, 3,
+		};
+
+		// entity index + 1, 0 marks an empty slot
+		inline constexpr std::uint16_t slots[slot_count] =
+		{
+			0, 0, 1720, 684, 40, 0, 474, 0, 2064, 0, 0, 0, 310, 1582, 0, 0,
+			257, 0, 0, 0, 0, 70, 0, 0, 1116, 1032, 0, 0, 0, 0, 750, 0,
+			0, 1186, 573, 0, 0, 1373, 0, 0, 0, 1473, 523, 221, 0, 161, 61, 0,
+			0, 0, 0, 1547, 0, 1695, 1446, 0, 2079, 299, 0, 0, 1348, 0, 0, 1919,
+			889, 1807, 0, 0, 0, 0, 339, 0, 0, 0, 143, 0, 239, 0, 405, 1851,
+			0, 0, 0, 0, 0, 1845, 259, 1272, 91, 931, 0, 0, 0, 0, 996, 1085,
+			0, 354, 0, 0, 0, 155, 0, 0, 0, 0, 0, 1483, 721, 0, 0, 872,
+			0, 1923, 0, 54, 0, 411, 0, 0, 0, 0, 701, 113, 1912, 2052, 0, 619,
+			1827, 0, 0, 0, 2051, 1690, 0, 0, 1750, 1399, 0, 92, 284, 0, 1254, 375,
+			0, 0, 0, 0, 0, 0, 0, 813, 2035, 0, 0, 0, 1961, 341, 975, 0,
+			0, 1114, 0, 0, 2038, 0, 0, 1763, 1594, 353, 399, 1166, 0, 0, 1928, 307,
+			1611, 842, 0, 1591, 0, 722, 0, 0, 85, 0, 263, 1826, 0, 0, 458, 435,
+			589, 693, 183, 0, 1339, 1868, 0, 0, 0, 758, 1106, 0, 791, 0, 650, 179,
+			0, 0, 1965, 0, 0, 0, 1800, 939, 0, 0, 0, 1251, 343, 0, 1697, 1168,
+			1814, 303, 1930, 0, 0, 1955, 0, 755, 0, 1039, 0, 1335, 1839, 1856, 1584, 0,
+			0, 0, 0, 0, 0, 820, 0, 517, 0, 0, 1301, 1493, 0, 0, 0, 563,
+			0, 2018, 864, 1534, 702, 554, 1384, 907, 0, 1135, 0, 873, 225, 0, 1060, 0,
+			1830, 0, 1136, 797, 0, 351, 0, 2045, 2026, 0, 510, 0, 186, 0, 373, 0,
+			0, 0, 0, 0, 0, 837, 1903, 141, 445, 527, 1455, 1589, 0, 0, 0, 1298,
+			0, 0, 0, 682, 46, 1282, 0, 1954, 346, 0, 1752, 450, 0, 0, 1536, 0,
+			0, 0, 316, 0, 2093, 0, 0, 480, 0, 0, 0, 191, 2055, 1897, 0, 1463,
+			1659, 0, 912, 0, 0, 1951, 0, 0, 0, 856, 0, 0, 228, 1324, 477, 0,
+			0, 679, 0, 0, 1369, 0, 6, 1560, 0, 0, 487, 0, 0, 499, 946, 334,
+			2006, 0, 1773, 2100, 643, 1082, 0, 1634, 1764, 0, 0, 1428, 0, 0, 0, 0,
+			944, 0, 109, 0, 0, 0, 1885, 173, 1034, 0, 0, 392, 529, 0, 967, 0,
+			1429, 0, 0, 149, 760, 0, 0, 0, 810, 1637, 0, 0, 1628, 727, 0, 0,
+			0, 1784, 0, 0, 0, 0, 193, 0, 0, 0, 29, 1558, 2009, 2022, 606, 1072,
+			2071, 0, 1699, 901, 1445, 789, 1545, 1365, 0, 1355, 0, 972, 0, 0, 439, 0,
+			0, 0, 0, 0, 276, 0, 0, 1023, 0, 1835, 0, 1223, 0, 269, 0, 1201,
+			1836, 0, 0, 308, 0, 1011, 0, 0, 557, 0, 1950, 0, 1685, 0, 0, 39,
+			0, 0, 0, 0, 0, 719, 0, 1551, 0, 476, 0, 1842, 0, 1691, 0, 18,
+			45, 1195, 0, 0, 548, 0, 1397, 0, 0, 1571, 0, 0, 0, 0, 1069, 1854,
+			110, 0, 1440, 0, 0, 804, 0, 475, 711, 932, 843, 443, 654, 0, 0, 0,
+			1025, 0, 1000, 0, 0, 0, 30, 1243, 0, 384, 355, 1444, 0, 0, 0, 0,
+			0, 1420, 0, 1103, 55, 868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 96, 394, 0, 1867, 0, 0, 0, 0, 1682, 1477, 1596, 1336, 0, 1448, 1791,
+			0, 0, 1340, 0, 2007, 431, 689, 0, 0, 0, 0, 0, 0, 0, 408, 0,
+			0, 20, 275, 0, 0, 1351, 0, 99, 0, 2039, 616, 749, 0, 0, 611, 615,
+			700, 0, 1921, 990, 49, 57, 0, 627, 1407, 898, 0, 0, 0, 1887, 0, 0,
+			1631, 123, 0, 1271, 497, 253, 1774, 991, 0, 148, 0, 0, 0, 0, 0, 0,
+			1625, 519, 0, 613, 1014, 1901, 0, 1468, 0, 0, 567, 0, 1525, 126, 1786, 21,
+			1787, 0, 1944, 1702, 1013, 0, 2116, 0, 0, 0, 1664, 441, 1522, 950, 502, 0,
+			0, 0, 50, 1575, 1246, 622, 31, 0, 1280, 0, 1120, 0, 1916, 0, 1846, 1731,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 401, 1717, 814, 1979,
+			0, 1949, 478, 0, 1002, 361, 0, 1967, 531, 0, 446, 0, 0, 1005, 0, 442,
+			0, 1577, 278, 11, 1020, 402, 1392, 0, 1087, 1724, 2066, 1942, 0, 0, 792, 368,
+			447, 1644, 1561, 0, 2023, 644, 0, 336, 0, 98, 0, 1884, 0, 0, 1859, 77,
+			187, 0, 232, 378, 0, 1152, 0, 1151, 0, 934, 1124, 0, 1806, 1380, 0, 1389,
+			0, 0, 0, 0, 1091, 1487, 970, 1108, 947, 465, 0, 994, 0, 572, 0, 0,
+			1347, 0, 0, 2121, 1929, 1286, 1409, 953, 0, 1604, 620, 831, 1140, 0, 0, 1831,
+			0, 0, 0, 0, 1713, 0, 1104, 0, 903, 0, 28, 0, 1315, 1677, 1894, 0,
+			1711, 565, 902, 0, 0, 1777, 0, 0, 0, 0, 1302, 437, 230, 0, 0, 854,
+			0, 114, 0, 1194, 1759, 1696, 0, 0, 1433, 0, 0, 0, 0, 0, 1934, 0,
+			0, 0, 1045, 2059, 1452, 0, 238, 1320, 960, 0, 0, 1342, 0, 0, 0, 0,
+			0, 1449, 0, 1630, 0, 0, 759, 0, 0, 1549, 899, 0, 0, 0, 0, 0,
+			0, 32, 1603, 1795, 0, 697, 1227, 0, 219, 0, 306, 1708, 463, 807, 323, 2119,
+			0, 0, 0, 0, 0, 621, 1093, 522, 0, 0, 514, 0, 723, 1294, 580, 0,
+			0, 0, 0, 0, 1163, 202, 2036, 385, 461, 133, 125, 0, 434, 0, 878, 817,
+			0, 472, 1760, 0, 0, 0, 1229, 1683, 0, 1048, 0, 0, 0, 962, 0, 0,
+			0, 840, 0, 0, 0, 1230, 1026, 1633, 0, 0, 0, 358, 1366, 0, 142, 2050,
+			1212, 0, 95, 0, 0, 120, 0, 1086, 0, 1530, 498, 0, 1886, 0, 0, 0,
+			0, 0, 647, 536, 612, 0, 0, 390, 0, 1344, 1067, 798, 0, 0, 0, 1686,
+			0, 0, 796, 0, 2000, 0, 0, 0, 0, 634, 1310, 1418, 33, 0, 0, 0,
+			0, 0, 0, 671, 0, 0, 13, 2098, 0, 2102, 539, 1144, 0, 1532, 0, 1822,
+			593, 0, 1499, 0, 1356, 1513, 0, 0, 0, 0, 0, 0, 924, 0, 685, 0,
+			1600, 0, 978, 586, 1905, 0, 0, 0, 396, 0, 1341, 0, 492, 1566, 0, 0,
+			0, 0, 0, 0, 0, 0, 508, 578, 0, 0, 532, 564, 200, 1714, 0, 1911,
+			993, 0, 0, 1941, 0, 956, 1850, 1456, 748, 0, 733, 172, 0, 574, 0, 717,
+			0, 1975, 2005, 2037, 550, 2062, 0, 0, 0, 0, 0, 0, 0, 0, 1245, 0,
+			0, 0, 1323, 52, 470, 0, 0, 1646, 1382, 0, 485, 177, 0, 1920, 235, 0,
+			0, 1111, 1645, 0, 0, 0, 406, 0, 0, 0, 0, 0, 1325, 5, 1945, 1162,
+			1232, 0, 630, 0, 0, 1170, 1215, 0, 1422, 525, 1480, 0, 0, 294, 0, 0,
+			348, 0, 0, 159, 1225, 558, 1181, 38, 0, 0, 395, 0, 0, 459, 0, 0,
+			1490, 1412, 2027, 0, 739, 0, 0, 0, 1988, 0, 0, 0, 137, 0, 740, 246,
+			1993, 1963, 1308, 146, 1933, 1597, 1193, 0, 1732, 0, 1040, 0, 0, 0, 0, 1372,
+			0, 0, 1725, 920, 0, 3, 0, 0, 0, 0, 0, 0, 68, 417, 0, 607,
+			0, 0, 0, 624, 0, 0, 1709, 0, 0, 794, 1451, 0, 734, 1621, 0, 0,
+			1811, 0, 1563, 0, 1486, 0, 1122, 0, 0, 0, 1425, 101, 0, 0, 326, 1647,
+			664, 0, 0, 0, 0, 0, 513, 208, 1614, 774, 0, 2105, 430, 1261, 1681, 0,
+			1390, 207, 287, 464, 1303, 398, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1326, 737, 1052, 274, 90, 0, 0, 236, 0, 1984, 1510, 1908, 0, 918, 0, 706,
+			0, 1906, 598, 0, 0, 1938, 1148, 0, 0, 0, 1837, 783, 1244, 1047, 59, 0,
+			0, 914, 1393, 0, 0, 0, 1003, 1852, 1312, 894, 1881, 0, 0, 117, 0, 716,
+			0, 0, 0, 1619, 0, 0, 0, 0, 97, 1137, 1821, 0, 925, 0, 1058, 0,
+			1985, 0, 0, 0, 1899, 0, 1160, 119, 192, 0, 0, 2076, 2077, 0, 0, 195,
+			1823, 582, 0, 892, 819, 1155, 948, 0, 0, 0, 917, 1327, 0, 0, 0, 1415,
+			1375, 0, 0, 0, 823, 0, 861, 1070, 0, 1643, 0, 1809, 0, 0, 130, 1293,
+			0, 0, 0, 0, 0, 0, 1598, 1411, 466, 0, 1267, 0, 0, 1688, 152, 544,
+			2115, 127, 1414, 1590, 1990, 0, 0, 680, 0, 0, 1387, 0, 1562, 1573, 1943, 252,
+			0, 549, 0, 0, 2074, 1931, 0, 0, 2070, 0, 0, 575, 1541, 0, 438, 0,
+			1872, 0, 0, 0, 0, 2078, 0, 170, 118, 0, 0, 506, 0, 0, 0, 0,
+			0, 0, 505, 0, 0, 0, 0, 1883, 234, 0, 0, 0, 0, 1554, 0, 0,
+			2065, 440, 1785, 1838, 138, 1767, 0, 0, 0, 1730, 547, 0, 1917, 0, 0, 1698,
+			2101, 1719, 1317, 455, 1221, 999, 1402, 0, 1907, 1010, 0, 0, 592, 1689, 1537, 1314,
+			0, 0, 0, 0, 266, 344, 0, 1037, 0, 1075, 1505, 0, 0, 0, 0, 0,
+			961, 1096, 227, 0, 1030, 0, 121, 0, 1712, 0, 1426, 1504, 0, 1289, 0, 1853,
+			1439, 0, 815, 0, 1092, 1583, 1650, 0, 2061, 1333, 1704, 1970, 860, 1579, 1960, 0,
+			0, 0, 1952, 0, 2090, 937, 426, 0, 1283, 0, 1078, 714, 0, 777, 0, 862,
+			0, 2001, 0, 0, 1876, 0, 1654, 0, 1278, 1880, 844, 1138, 451, 1105, 1071, 0,
+			0, 81, 1036, 69, 1640, 0, 0, 0, 100, 214, 773, 1797, 0, 0, 360, 594,
+			0, 526, 0, 199, 0, 0, 1605, 1792, 1287, 0, 0, 0, 1363, 0, 0, 1156,
+			483, 1841, 17, 0, 1197, 0, 1889, 270, 1742, 0, 0, 0, 602, 809, 1757, 1904,
+			0, 1662, 0, 824, 1234, 0, 0, 707, 1029, 0, 175, 1123, 2083, 0, 1362, 968,
+			1501, 0, 0, 756, 1693, 0, 0, 1171, 0, 1252, 0, 0, 1796, 636, 0, 752,
+			1059, 1869, 0, 0, 0, 674, 0, 0, 255, 1515, 1284, 215, 0, 1514, 1618, 1129,
+			0, 0, 0, 0, 0, 295, 0, 0, 657, 0, 0, 0, 0, 1266, 2075, 0,
+			0, 646, 0, 576, 0, 1274, 0, 0, 793, 449, 1165, 666, 0, 1840, 1948, 0,
+			1756, 0, 0, 0, 0, 0, 1015, 1146, 0, 0, 672, 1007, 0, 0, 0, 746,
+			2072, 0, 501, 1722, 0, 0, 725, 909, 1754, 1529, 342, 1377, 0, 264, 795, 1810,
+			1578, 2113, 0, 0, 2044, 0, 1935, 332, 244, 652, 16, 58, 424, 226, 283, 1109,
+			0, 0, 2049, 1875, 64, 0, 1498, 0, 495, 0, 1533, 0, 1233, 1461, 0, 0,
+			0, 0, 0, 1088, 891, 0, 2024, 0, 222, 530, 162, 377, 0, 0, 318, 1189,
+			0, 1489, 1733, 2109, 240, 1898, 1925, 0, 0, 1305, 0, 0, 0, 1745, 906, 0,
+			1009, 595, 0, 213, 0, 0, 0, 1517, 0, 0, 0, 0, 605, 0, 1134, 154,
+			0, 1924, 0, 0, 0, 660, 0, 0, 0, 0, 0, 1113, 0, 743, 2085, 0,
+			0, 381, 0, 0, 0, 0, 1202, 952, 0, 0, 0, 0, 0, 340, 0, 2020,
+			41, 156, 0, 718, 1996, 0, 1926, 338, 645, 0, 1914, 0, 0, 201, 0, 356,
+			0, 1946, 696, 1131, 0, 0, 0, 0, 0, 400, 1986, 0, 280, 0, 603, 0,
+			966, 1671, 0, 0, 2110, 0, 715, 0, 1670, 703, 0, 0, 484, 0, 1408, 2091,
+			19, 0, 471, 1469, 1804, 1204, 0, 0, 1734, 0, 250, 312, 1180, 858, 0, 1313,
+			0, 581, 1304, 0, 0, 0, 0, 0, 0, 0, 1825, 0, 1055, 0, 1346, 0,
+			0, 1798, 0, 1746, 1228, 0, 0, 0, 0, 959, 2041, 1581, 943, 0, 0, 0,
+			0, 951, 542, 122, 1081, 1208, 0, 304, 744, 290, 0, 0, 1056, 0, 591, 1820,
+			0, 26, 363, 0, 0, 0, 1999, 1464, 1882, 0, 0, 0, 0, 1199, 1395, 0,
+			1790, 979, 1909, 370, 106, 1250, 0, 0, 0, 0, 0, 0, 2004, 0, 107, 1692,
+			374, 853, 1723, 0, 1502, 0, 317, 710, 641, 0, 0, 1090, 1857, 0, 0, 808,
+			976, 0, 0, 0, 0, 1936, 105, 1065, 0, 0, 732, 0, 1567, 1467, 0, 1586,
+			1861, 357, 1263, 0, 0, 0, 0, 0, 0, 870, 1701, 349, 249, 2103, 421, 1184,
+			0, 412, 1021, 0, 1371, 0, 608, 1381, 0, 1482, 0, 2087, 1766, 849, 545, 767,
+			1556, 1832, 0, 1424, 0, 448, 169, 0, 938, 124, 369, 0, 1334, 0, 0, 1238,
+			0, 0, 577, 0, 2011, 0, 0, 0, 258, 108, 0, 0, 1396, 0, 0, 1173,
+			1269, 271, 0, 0, 0, 0, 0, 1192, 0, 0, 1311, 1064, 1613, 669, 963, 2047,
+			0, 1663, 1680, 365, 0, 0, 0, 0, 0, 614, 0, 704, 1459, 0, 933, 653,
+			1937, 1758, 140, 0, 1740, 0, 223, 0, 571, 0, 0, 0, 887, 741, 0, 1569,
+			0, 0, 1427, 0, 1642, 1224, 1873, 1849, 0, 0, 0, 0, 2073, 1675, 217, 231,
+			0, 0, 0, 0, 2081, 648, 1728, 0, 1337, 0, 0, 788, 954, 0, 742, 509,
+			362, 104, 0, 0, 0, 908, 834, 0, 0, 0, 1388, 0, 0, 1860, 0, 0,
+			1370, 488, 0, 335, 987, 1639, 1788, 0, 0, 1158, 386, 507, 1508, 1519, 1470, 1599,
+			588, 297, 132, 0, 0, 0, 0, 0, 260, 0, 0, 826, 0, 1769, 1435, 131,
+			0, 314, 0, 0, 1044, 0, 165, 0, 0, 0, 0, 0, 2106, 1265, 0, 0,
+			288, 1076, 1247, 812, 0, 0, 1196, 0, 1915, 0, 0, 0, 2032, 0, 2054, 618,
+			0, 0, 0, 0, 1568, 897, 866, 1535, 2058, 2029, 1231, 1443, 0, 0, 0, 1602,
+			0, 160, 0, 0, 1673, 0, 0, 93, 865, 0, 456, 0, 1896, 243, 0, 763,
+			2028, 2015, 698, 0, 359, 1892, 599, 0, 0, 0, 0, 1239, 0, 738, 0, 452,
+			0, 0, 185, 0, 1565, 0, 281, 1049, 315, 79, 1432, 859, 0, 0, 911, 0,
+			0, 1676, 0, 0, 331, 0, 0, 0, 1291, 765, 1783, 0, 1976, 0, 432, 1241,
+			0, 0, 0, 1321, 0, 919, 1587, 0, 1098, 9, 0, 0, 1268, 1352, 768, 1401,
+			0, 945, 0, 0, 0, 0, 0, 1084, 1980, 0, 1793, 0, 1772, 0, 0, 302,
+			0, 1361, 0, 556, 822, 496, 0, 0, 2046, 1248, 203, 0, 0, 56, 0, 1400,
+			0, 1262, 0, 0, 0, 0, 675, 518, 665, 0, 1531, 568, 0, 391, 1778, 0,
+			0, 926, 1164, 2, 0, 0, 0, 0, 0, 0, 670, 1479, 0, 1475, 1119, 0,
+			0, 1812, 880, 0, 0, 1169, 1989, 1617, 190, 1260, 0, 0, 524, 1319, 0, 2111,
+			181, 206, 0, 0, 0, 0, 0, 690, 1780, 0, 995, 2084, 1450, 659, 1781, 631,
+			0, 0, 0, 0, 1378, 0, 168, 1816, 811, 2068, 1275, 2125, 311, 971, 2008, 0,
+			1338, 1214, 0, 0, 0, 0, 1255, 0, 0, 0, 1620, 0, 1507, 833, 0, 0,
+			0, 1117, 62, 0, 0, 1776, 0, 687, 625, 0, 0, 940, 2019, 345, 781, 0,
+			597, 0, 479, 0, 0, 4, 1890, 2099, 0, 1187, 0, 0, 0, 111, 0, 2096,
+			0, 0, 0, 0, 869, 609, 1564, 0, 852, 0, 1167, 0, 692, 745, 1043, 1453,
+			0, 0, 63, 0, 1132, 1019, 0, 0, 1918, 60, 0, 0, 0, 0, 1159, 197,
+			0, 0, 1997, 0, 0, 0, 164, 1277, 0, 0, 1130, 1870, 900, 0, 0, 584,
+			2063, 841, 2112, 0, 1715, 1127, 0, 989, 1004, 0, 0, 1632, 0, 489, 1383, 1054,
+			0, 874, 2043, 0, 2030, 0, 0, 1237, 0, 617, 1050, 1550, 1626, 1179, 0, 0,
+			0, 0, 800, 0, 0, 0, 847, 0, 2010, 1295, 1074, 380, 0, 0, 1306, 0,
+			1172, 0, 0, 1751, 0, 0, 0, 1834, 0, 1249, 0, 0, 0, 0, 0, 0,
+			0, 1062, 0, 0, 1636, 0, 890, 639, 0, 1527, 676, 590, 0, 941, 1940, 102,
+			640, 1939, 2033, 300, 1983, 1038, 0, 153, 0, 1073, 0, 35, 0, 1657, 0, 279,
+			730, 0, 2048, 0, 1008, 0, 229, 158, 212, 882, 0, 1543, 1276, 376, 0, 0,
+			886, 1910, 0, 0, 0, 2067, 0, 0, 0, 0, 350, 0, 2123, 0, 1345, 0,
+			0, 0, 1061, 0, 0, 0, 1094, 1595, 0, 0, 0, 0, 0, 0, 1592, 904,
+			1403, 0, 0, 145, 1404, 818, 0, 0, 1844, 0, 0, 1958, 1668, 1210, 0, 922,
+			0, 0, 1080, 0, 1607, 871, 0, 151, 2003, 1465, 1653, 1684, 0, 1775, 884, 0,
+			0, 0, 0, 512, 1413, 0, 1157, 0, 0, 0, 705, 1182, 76, 0, 0, 320,
+			0, 0, 0, 0, 0, 1982, 0, 850, 0, 982, 0, 1126, 0, 0, 1410, 491,
+			0, 0, 0, 0, 0, 0, 2056, 658, 1281, 296, 0, 708, 1995, 0, 1398, 2017,
+			414, 0, 112, 0, 0, 729, 1616, 662, 0, 0, 0, 1987, 0, 404, 803, 1895,
+			268, 1557, 0, 1553, 291, 0, 0, 921, 0, 0, 0, 0, 84, 1273, 0, 0,
+			43, 409, 686, 0, 1972, 546, 0, 0, 1095, 0, 0, 893, 0, 0, 87, 867,
+			1744, 835, 0, 0, 0, 0, 1417, 0, 0, 1279, 0, 0, 0, 2089, 766, 180,
+			827, 0, 0, 0, 988, 2034, 0, 48, 0, 0, 560, 677, 0, 0, 1222, 167,
+			596, 115, 1528, 0, 53, 0, 1256, 0, 929, 0, 828, 561, 1736, 1300, 0, 0,
+			178, 319, 1175, 1601, 836, 27, 0, 1046, 0, 552, 372, 0, 1041, 0, 0, 0,
+			0, 0, 0, 1379, 1506, 787, 0, 1406, 0, 0, 364, 0, 0, 329, 0, 1213,
+			0, 0, 0, 0, 1574, 699, 0, 1606, 1932, 67, 0, 0, 848, 282, 0, 298,
+			0, 0, 896, 0, 0, 1442, 418, 182, 0, 0, 0, 1332, 1500, 0, 0, 0,
+			1748, 0, 47, 1737, 305, 0, 0, 196, 516, 0, 0, 764, 1343, 0, 713, 0,
+			0, 769, 0, 0, 0, 1735, 0, 1183, 0, 977, 1570, 1971, 0, 0, 397, 7,
+			528, 1641, 0, 1612, 1968, 1053, 1922, 1357, 1154, 0, 0, 806, 0, 1430, 1472, 1953,
+			1824, 0, 0, 0, 668, 292, 1863, 0, 0, 0, 786, 0, 0, 0, 0, 1576,
+			757, 218, 1492, 0, 0, 0, 0, 366, 0, 661, 1994, 649, 0, 211, 2080, 1330,
+			984, 583, 1624, 0, 1290, 663, 0, 0, 204, 628, 0, 579, 0, 0, 0, 0,
+			0, 1259, 0, 1555, 504, 0, 0, 1679, 325, 256, 0, 1981, 1292, 1485, 724, 0,
+			0, 535, 0, 0, 1741, 1145, 601, 0, 0, 0, 1726, 0, 1001, 736, 829, 0,
+			0, 0, 1031, 1656, 1729, 0, 1203, 82, 0, 1309, 0, 1057, 1627, 1962, 0, 1703,
+			0, 1707, 0, 681, 0, 0, 0, 0, 382, 635, 0, 0, 1779, 0, 0, 1721,
+			66, 0, 0, 857, 1808, 210, 1743, 0, 24, 0, 521, 0, 248, 0, 0, 0,
+			0, 0, 352, 0, 0, 0, 337, 1687, 0, 0, 0, 0, 876, 720, 1496, 1503,
+			174, 1177, 0, 2088, 419, 1833, 0, 1288, 139, 0, 983, 1805, 1358, 0, 992, 416,
+			1658, 0, 0, 1434, 0, 0, 1128, 247, 0, 626, 1672, 0, 0, 0, 0, 845,
+			1580, 1110, 1520, 0, 0, 667, 0, 0, 553, 413, 0, 935, 0, 0, 1466, 0,
+			1226, 0, 928, 610, 0, 1476, 0, 1771, 1585, 0, 0, 0, 134, 0, 0, 0,
+			0, 0, 1900, 425, 1635, 0, 1516, 0, 1216, 709, 205, 1099, 1801, 171, 2016, 136,
+			0, 1153, 0, 0, 1765, 2108, 832, 0, 0, 0, 1947, 0, 0, 1888, 555, 965,
+			1097, 0, 0, 321, 1913, 78, 2012, 566, 0, 0, 0, 0, 825, 0, 0, 333,
+			0, 0, 0, 0, 782, 1285, 1661, 1588, 1761, 1523, 712, 0, 802, 0, 1391, 0,
+			801, 74, 1511, 1176, 128, 0, 1447, 1209, 1206, 0, 0, 330, 1458, 2060, 1200, 237,
+			1789, 1207, 600, 0, 0, 0, 0, 1649, 1331, 420, 1174, 0, 784, 0, 1438, 1016,
+			0, 0, 1638, 0, 0, 1927, 0, 1240, 0, 1694, 2120, 0, 254, 1819, 1350, 0,
+			0, 2057, 0, 585, 1474, 1118, 500, 37, 0, 1828, 735, 0, 0, 0, 779, 1891,
+			1518, 0, 1998, 1079, 775, 1354, 905, 428, 0, 930, 2069, 1738, 0, 0, 309, 2086,
+			103, 0, 1678, 0, 0, 0, 1651, 0, 879, 1142, 1471, 2124, 1593, 1669, 1100, 0,
+			1107, 2095, 0, 772, 0, 1548, 0, 515, 0, 0, 0, 1253, 0, 301, 694, 486,
+			481, 656, 1782, 1264, 540, 1957, 0, 0, 0, 1973, 388, 1205, 0, 0, 0, 1629,
+			1190, 0, 1143, 0, 1544, 726, 0, 503, 1235, 0, 0, 1394, 0, 0, 0, 0,
+			0, 0, 1139, 0, 65, 0, 88, 688, 0, 0, 0, 1749, 393, 0, 0, 1051,
+			0, 0, 0, 0, 0, 0, 12, 1147, 0, 0, 0, 1956, 454, 0, 0, 0,
+			0, 0, 176, 494, 0, 1539, 469, 785, 0, 0, 805, 83, 511, 224, 0, 135,
+			0, 633, 265, 569, 1068, 116, 1877, 0, 1608, 1028, 1478, 0, 1296, 1198, 0, 2053,
+			0, 324, 0, 1794, 655, 0, 985, 462, 423, 216, 277, 0, 1706, 0, 2002, 0,
+			1879, 1257, 42, 1977, 1803, 0, 2021, 1768, 0, 1862, 986, 0, 0, 0, 1022, 851,
+			233, 969, 286, 753, 490, 1491, 0, 1454, 0, 683, 1297, 0, 0, 0, 0, 1667,
+			0, 0, 0, 0, 2097, 1423, 0, 0, 0, 790, 0, 1799, 73, 0, 838, 0,
+			1457, 0, 1149, 0, 1307, 0, 888, 0, 0, 8, 407, 0, 0, 0, 0, 0,
+			0, 72, 0, 0, 0, 1441, 1121, 863, 189, 0, 1318, 0, 0, 1436, 22, 1747,
+			0, 0, 1360, 0, 1063, 0, 0, 1864, 0, 1874, 163, 0, 436, 0, 1815, 0,
+			973, 0, 1509, 2025, 0, 942, 1006, 0, 534, 0, 830, 0, 0, 1220, 1077, 0,
+			1353, 0, 0, 0, 0, 895, 923, 0, 0, 0, 1386, 0, 457, 0, 0, 0,
+			533, 1865, 1178, 1609, 0, 1615, 0, 0, 0, 1848, 0, 0, 0, 1813, 955, 0,
+			877, 0, 0, 1540, 0, 1012, 51, 1660, 0, 0, 0, 0, 322, 0, 0, 0,
+			957, 383, 0, 1219, 0, 2114, 86, 1718, 997, 1753, 0, 0, 0, 0, 0, 0,
+			1866, 0, 0, 0, 0, 0, 0, 0, 0, 493, 2118, 0, 0, 0, 389, 468,
+			0, 0, 0, 0, 0, 0, 1878, 0, 1966, 1460, 570, 885, 184, 1349, 998, 0,
+			1974, 770, 1512, 1666, 2094, 0, 0, 198, 0, 0, 415, 0, 0, 0, 0, 0,
+			587, 0, 0, 816, 241, 839, 0, 1322, 0, 1665, 2031, 2104, 1843, 981, 1964, 728,
+			1538, 980, 157, 0, 1521, 0, 1329, 1969, 747, 1559, 293, 1484, 1376, 15, 94, 0,
+			964, 0, 1991, 1762, 0, 0, 0, 75, 1033, 379, 0, 0, 1524, 1211, 403, 0,
+			821, 0, 0, 0, 0, 0, 1035, 0, 1242, 262, 1217, 537, 2122, 1623, 0, 0,
+			1437, 543, 0, 0, 1552, 0, 520, 71, 673, 1299, 0, 0, 0, 0, 1674, 751,
+			1024, 538, 0, 10, 1018, 0, 1770, 1, 194, 0, 422, 0, 1101, 0, 0, 1083,
+			2042, 1902, 0, 691, 0, 0, 0, 144, 0, 1655, 0, 1755, 949, 0, 0, 0,
+			881, 0, 913, 0, 1727, 695, 0, 0, 0, 0, 855, 220, 1316, 1112, 429, 1572,
+			453, 313, 1185, 0, 1133, 638, 0, 129, 0, 0, 1739, 273, 327, 1494, 0, 166,
+			1141, 0, 0, 1542, 467, 0, 1218, 0, 1374, 0, 1481, 0, 0, 1017, 0, 0,
+			2117, 0, 0, 0, 0, 604, 958, 0, 0, 0, 0, 0, 251, 0, 0, 0,
+			347, 0, 267, 0, 25, 910, 0, 0, 0, 367, 1992, 1359, 0, 0, 0, 651,
+			2014, 0, 410, 916, 0, 0, 433, 0, 34, 0, 0, 0, 1125, 0, 1115, 0,
+			0, 147, 0, 0, 1027, 1191, 0, 0, 0, 1817, 0, 2092, 2040, 1526, 0, 1462,
+			1705, 89, 0, 0, 0, 0, 562, 762, 2107, 0, 371, 927, 0, 289, 1089, 0,
+			0, 0, 0, 0, 328, 0, 0, 1546, 1893, 0, 0, 0, 761, 2082, 936, 1610,
+			1102, 285, 0, 778, 1802, 1871, 0, 915, 1710, 0, 1959, 0, 1405, 0, 776, 1847,
+			1236, 188, 0, 642, 1855, 242, 1431, 1161, 0, 559, 1716, 846, 0, 1270, 0, 0,
+			0, 150, 0, 1042, 1416, 1188, 0, 1818, 623, 629, 1700, 1258, 0, 1421, 632, 0,
+			0, 427, 36, 1385, 0, 0, 551, 1829, 0, 0, 1622, 245, 875, 799, 0, 0,
+			0, 0, 0, 1066, 0, 0, 460, 0, 0, 0, 0, 771, 444, 1497, 974, 1648,
+			0, 80, 0, 473, 0, 0, 2013, 678, 731, 1364, 1978, 387, 1488, 482, 261, 209,
+			0, 0, 0, 883, 0, 0, 0, 0, 541, 0, 14, 0, 1367, 0, 272, 0,
+			0, 1368, 0, 637, 0, 1858, 1495, 0, 1150, 0, 1328, 754, 1419, 1652, 44, 780,
+		};
+
+		// node 0 is the root
+		inline constexpr legacy_node legacy_nodes[legacy_node_count] =
+		{
+			{ 0, 32, 0 },
+			{ 32, 8, 0 },
+			{ 40, 1, 0 },
+			{ 41, 1, 0 },
+			{ 42, 1, 0 },
+			{ 43, 0, 1 },	// AElig
+			{ 43, 1, 0 },
+			{ 44, 0, 2 },	// AMP
+			{ 44, 1, 0 },
+			{ 45, 1, 0 },
+			{ 46, 1, 0 },
+			{ 47, 1, 0 },
+			{ 48, 0, 3 },	// Aacute
+			{ 48, 1, 0 },
+			{ 49, 1, 0 },
+			{ 50, 1, 0 },
+			{ 51, 0, 5 },	// Acirc
+			{ 51, 1, 0 },
+			{ 52, 1, 0 },
+			{ 53, 1, 0 },
+			{ 54, 1, 0 },
+			{ 55, 0, 8 },	// Agrave
+			{ 55, 1, 0 },
+			{ 56, 1, 0 },
+			{ 57, 1, 0 },
+			{ 58, 0, 15 },	// Aring
+			{ 58, 1, 0 },
+			{ 59, 1, 0 },
+			{ 60, 1, 0 },
+			{ 61, 1, 0 },
+			{ 62, 0, 18 },	// Atilde
+			{ 62, 1, 0 },
+			{ 63, 1, 0 },
+			{ 64, 0, 19 },	// Auml
+			{ 64, 2, 0 },
+			{ 66, 1, 0 },
+			{ 67, 1, 0 },
+			{ 68, 0, 33 },	// COPY
+			{ 68, 1, 0 },
+			{ 69, 1, 0 },
+			{ 70, 1, 0 },
+			{ 71, 1, 0 },
+			{ 72, 0, 39 },	// Ccedil
+			{ 72, 5, 0 },
+			{ 77, 1, 0 },
+			{ 78, 0, 121 },	// ETH
+			{ 78, 1, 0 },
+			{ 79, 1, 0 },
+			{ 80, 1, 0 },
+			{ 81, 1, 0 },
+			{ 82, 0, 122 },	// Eacute
+			{ 82, 1, 0 },
+			{ 83, 1, 0 },
+			{ 84, 1, 0 },
+			{ 85, 0, 124 },	// Ecirc
+			{ 85, 1, 0 },
+			{ 86, 1, 0 },
+			{ 87, 1, 0 },
+			{ 88, 1, 0 },
+			{ 89, 0, 128 },	// Egrave
+			{ 89, 1, 0 },
+			{ 90, 1, 0 },
+			{ 91, 0, 142 },	// Euml
+			{ 91, 1, 0 },
+			{ 92, 0, 154 },	// GT
+			{ 92, 4, 0 },
+			{ 96, 1, 0 },
+			{ 97, 1, 0 },
+			{ 98, 1, 0 },
+			{ 99, 1, 0 },
+			{ 100, 0, 189 },	// Iacute
+			{ 100, 1, 0 },
+			{ 101, 1, 0 },
+			{ 102, 1, 0 },
+			{ 103, 0, 190 },	// Icirc
+			{ 103, 1, 0 },
+			{ 104, 1, 0 },
+			{ 105, 1, 0 },
+			{ 106, 1, 0 },
+			{ 107, 0, 194 },	// Igrave
+			{ 107, 1, 0 },
+			{ 108, 1, 0 },
+			{ 109, 0, 210 },	// Iuml
+			{ 109, 1, 0 },
+			{ 110, 0, 227 },	// LT
+			{ 110, 1, 0 },
+			{ 111, 1, 0 },
+			{ 112, 1, 0 },
+			{ 113, 1, 0 },
+			{ 114, 1, 0 },
+			{ 115, 0, 363 },	// Ntilde
+			{ 115, 6, 0 },
+			{ 121, 1, 0 },
+			{ 122, 1, 0 },
+			{ 123, 1, 0 },
+			{ 124, 1, 0 },
+			{ 125, 0, 366 },	// Oacute
+			{ 125, 1, 0 },
+			{ 126, 1, 0 },
+			{ 127, 1, 0 },
+			{ 128, 0, 367 },	// Ocirc
+			{ 128, 1, 0 },
+			{ 129, 1, 0 },
+			{ 130, 1, 0 },
+			{ 131, 1, 0 },
+			{ 132, 0, 371 },	// Ograve
+			{ 132, 1, 0 },
+			{ 133, 1, 0 },
+			{ 134, 1, 0 },
+			{ 135, 1, 0 },
+			{ 136, 0, 380 },	// Oslash
+			{ 136, 1, 0 },
+			{ 137, 1, 0 },
+			{ 138, 1, 0 },
+			{ 139, 1, 0 },
+			{ 140, 0, 381 },	// Otilde
+			{ 140, 1, 0 },
+			{ 141, 1, 0 },
+			{ 142, 0, 383 },	// Ouml
+			{ 142, 1, 0 },
+			{ 143, 1, 0 },
+			{ 144, 1, 0 },
+			{ 145, 0, 407 },	// QUOT
+			{ 145, 1, 0 },
+			{ 146, 1, 0 },
+			{ 147, 0, 412 },	// REG
+			{ 147, 1, 0 },
+			{ 148, 1, 0 },
+			{ 149, 1, 0 },
+			{ 150, 1, 0 },
+			{ 151, 0, 495 },	// THORN
+			{ 151, 4, 0 },
+			{ 155, 1, 0 },
+			{ 156, 1, 0 },
+			{ 157, 1, 0 },
+			{ 158, 1, 0 },
+			{ 159, 0, 517 },	// Uacute
+			{ 159, 1, 0 },
+			{ 160, 1, 0 },
+			{ 161, 1, 0 },
+			{ 162, 0, 522 },	// Ucirc
+			{ 162, 1, 0 },
+			{ 163, 1, 0 },
+			{ 164, 1, 0 },
+			{ 165, 1, 0 },
+			{ 166, 0, 526 },	// Ugrave
+			{ 166, 1, 0 },
+			{ 167, 1, 0 },
+			{ 168, 0, 552 },	// Uuml
+			{ 168, 1, 0 },
+			{ 169, 1, 0 },
+			{ 170, 1, 0 },
+			{ 171, 1, 0 },
+			{ 172, 1, 0 },
+			{ 173, 0, 582 },	// Yacute
+			{ 173, 8, 0 },
+			{ 181, 1, 0 },
+			{ 182, 1, 0 },
+			{ 183, 1, 0 },
+			{ 184, 1, 0 },
+			{ 185, 0, 599 },	// aacute
+			{ 185, 2, 0 },
+			{ 187, 1, 0 },
+			{ 188, 1, 0 },
+			{ 189, 0, 604 },	// acirc
+			{ 189, 1, 0 },
+			{ 190, 1, 0 },
+			{ 191, 0, 605 },	// acute
+			{ 191, 1, 0 },
+			{ 192, 1, 0 },
+			{ 193, 1, 0 },
+			{ 194, 0, 607 },	// aelig
+			{ 194, 1, 0 },
+			{ 195, 1, 0 },
+			{ 196, 1, 0 },
+			{ 197, 1, 0 },
+			{ 198, 0, 610 },	// agrave
+			{ 198, 1, 0 },
+			{ 199, 0, 616 },	// amp
+			{ 199, 1, 0 },
+			{ 200, 1, 0 },
+			{ 201, 1, 0 },
+			{ 202, 0, 650 },	// aring
+			{ 202, 1, 0 },
+			{ 203, 1, 0 },
+			{ 204, 1, 0 },
+			{ 205, 1, 0 },
+			{ 206, 0, 655 },	// atilde
+			{ 206, 1, 0 },
+			{ 207, 1, 0 },
+			{ 208, 0, 656 },	// auml
+			{ 208, 1, 0 },
+			{ 209, 1, 0 },
+			{ 210, 1, 0 },
+			{ 211, 1, 0 },
+			{ 212, 1, 0 },
+			{ 213, 0, 760 },	// brvbar
+			{ 213, 4, 0 },
+			{ 217, 1, 0 },
+			{ 218, 1, 0 },
+			{ 219, 1, 0 },
+			{ 220, 1, 0 },
+			{ 221, 0, 786 },	// ccedil
+			{ 221, 2, 0 },
+			{ 223, 1, 0 },
+			{ 224, 1, 0 },
+			{ 225, 0, 791 },	// cedil
+			{ 225, 1, 0 },
+			{ 226, 0, 793 },	// cent
+			{ 226, 1, 0 },
+			{ 227, 1, 0 },
+			{ 228, 0, 831 },	// copy
+			{ 228, 1, 0 },
+			{ 229, 1, 0 },
+			{ 230, 1, 0 },
+			{ 231, 1, 0 },
+			{ 232, 0, 860 },	// curren
+			{ 232, 2, 0 },
+			{ 234, 1, 0 },
+			{ 235, 0, 883 },	// deg
+			{ 235, 1, 0 },
+			{ 236, 1, 0 },
+			{ 237, 1, 0 },
+			{ 238, 1, 0 },
+			{ 239, 0, 898 },	// divide
+			{ 239, 5, 0 },
+			{ 244, 1, 0 },
+			{ 245, 1, 0 },
+			{ 246, 1, 0 },
+			{ 247, 1, 0 },
+			{ 248, 0, 934 },	// eacute
+			{ 248, 1, 0 },
+			{ 249, 1, 0 },
+			{ 250, 1, 0 },
+			{ 251, 0, 938 },	// ecirc
+			{ 251, 1, 0 },
+			{ 252, 1, 0 },
+			{ 253, 1, 0 },
+			{ 254, 1, 0 },
+			{ 255, 0, 946 },	// egrave
+			{ 255, 1, 0 },
+			{ 256, 0, 987 },	// eth
+			{ 256, 1, 0 },
+			{ 257, 1, 0 },
+			{ 258, 0, 988 },	// euml
+			{ 258, 1, 0 },
+			{ 259, 1, 0 },
+			{ 260, 1, 0 },
+			{ 261, 2, 0 },
+			{ 263, 2, 0 },
+			{ 265, 0, 1012 },	// frac12
+			{ 265, 0, 1014 },	// frac14
+			{ 265, 1, 0 },
+			{ 266, 0, 1020 },	// frac34
+			{ 266, 1, 0 },
+			{ 267, 0, 1074 },	// gt
+			{ 267, 6, 0 },
+			{ 273, 1, 0 },
+			{ 274, 1, 0 },
+			{ 275, 1, 0 },
+			{ 276, 1, 0 },
+			{ 277, 0, 1117 },	// iacute
+			{ 277, 1, 0 },
+			{ 278, 1, 0 },
+			{ 279, 1, 0 },
+			{ 280, 0, 1119 },	// icirc
+			{ 280, 1, 0 },
+			{ 281, 1, 0 },
+			{ 282, 1, 0 },
+			{ 283, 0, 1122 },	// iexcl
+			{ 283, 1, 0 },
+			{ 284, 1, 0 },
+			{ 285, 1, 0 },
+			{ 286, 1, 0 },
+			{ 287, 0, 1125 },	// igrave
+			{ 287, 1, 0 },
+			{ 288, 1, 0 },
+			{ 289, 1, 0 },
+			{ 290, 1, 0 },
+			{ 291, 0, 1155 },	// iquest
+			{ 291, 1, 0 },
+			{ 292, 1, 0 },
+			{ 293, 0, 1166 },	// iuml
+			{ 293, 2, 0 },
+			{ 295, 1, 0 },
+			{ 296, 1, 0 },
+			{ 297, 1, 0 },
+			{ 298, 0, 1200 },	// laquo
+			{ 298, 0, 1321 },	// lt
+			{ 298, 2, 0 },
+			{ 300, 1, 0 },
+			{ 301, 1, 0 },
+			{ 302, 0, 1338 },	// macr
+			{ 302, 2, 0 },
+			{ 304, 1, 0 },
+			{ 305, 1, 0 },
+			{ 306, 0, 1354 },	// micro
+			{ 306, 1, 0 },
+			{ 307, 1, 0 },
+			{ 308, 1, 0 },
+			{ 309, 0, 1358 },	// middot
+			{ 309, 3, 0 },
+			{ 312, 1, 0 },
+			{ 313, 1, 0 },
+			{ 314, 0, 1396 },	// nbsp
+			{ 314, 1, 0 },
+			{ 315, 0, 1454 },	// not
+			{ 315, 1, 0 },
+			{ 316, 1, 0 },
+			{ 317, 1, 0 },
+			{ 318, 1, 0 },
+			{ 319, 0, 1510 },	// ntilde
+			{ 319, 7, 0 },
+			{ 326, 1, 0 },
+			{ 327, 1, 0 },
+			{ 328, 1, 0 },
+			{ 329, 1, 0 },
+			{ 330, 0, 1540 },	// oacute
+			{ 330, 1, 0 },
+			{ 331, 1, 0 },
+			{ 332, 1, 0 },
+			{ 333, 0, 1543 },	// ocirc
+			{ 333, 1, 0 },
+			{ 334, 1, 0 },
+			{ 335, 1, 0 },
+			{ 336, 1, 0 },
+			{ 337, 0, 1554 },	// ograve
+			{ 337, 1, 0 },
+			{ 338, 2, 0 },
+			{ 340, 0, 1578 },	// ordf
+			{ 340, 0, 1579 },	// ordm
+			{ 340, 1, 0 },
+			{ 341, 1, 0 },
+			{ 342, 1, 0 },
+			{ 343, 1, 0 },
+			{ 344, 0, 1585 },	// oslash
+			{ 344, 1, 0 },
+			{ 345, 1, 0 },
+			{ 346, 1, 0 },
+			{ 347, 1, 0 },
+			{ 348, 0, 1587 },	// otilde
+			{ 348, 1, 0 },
+			{ 349, 1, 0 },
+			{ 350, 0, 1590 },	// ouml
+			{ 350, 3, 0 },
+			{ 353, 1, 0 },
+			{ 354, 1, 0 },
+			{ 355, 0, 1593 },	// para
+			{ 355, 1, 0 },
+			{ 356, 1, 0 },
+			{ 357, 1, 0 },
+			{ 358, 1, 0 },
+			{ 359, 0, 1622 },	// plusmn
+			{ 359, 1, 0 },
+			{ 360, 1, 0 },
+			{ 361, 1, 0 },
+			{ 362, 0, 1628 },	// pound
+			{ 362, 1, 0 },
+			{ 363, 1, 0 },
+			{ 364, 1, 0 },
+			{ 365, 0, 1667 },	// quot
+			{ 365, 2, 0 },
+			{ 367, 1, 0 },
+			{ 368, 1, 0 },
+			{ 369, 1, 0 },
+			{ 370, 0, 1681 },	// raquo
+			{ 370, 1, 0 },
+			{ 371, 0, 1719 },	// reg
+			{ 371, 4, 0 },
+			{ 375, 1, 0 },
+			{ 376, 1, 0 },
+			{ 377, 0, 1793 },	// sect
+			{ 377, 1, 0 },
+			{ 378, 0, 1806 },	// shy
+			{ 378, 1, 0 },
+			{ 379, 3, 0 },
+			{ 382, 0, 1893 },	// sup1
+			{ 382, 0, 1894 },	// sup2
+			{ 382, 0, 1895 },	// sup3
+			{ 382, 1, 0 },
+			{ 383, 1, 0 },
+			{ 384, 1, 0 },
+			{ 385, 0, 1921 },	// szlig
+			{ 385, 2, 0 },
+			{ 387, 1, 0 },
+			{ 388, 1, 0 },
+			{ 389, 1, 0 },
+			{ 390, 0, 1941 },	// thorn
+			{ 390, 1, 0 },
+			{ 391, 1, 0 },
+			{ 392, 1, 0 },
+			{ 393, 0, 1943 },	// times
+			{ 393, 5, 0 },
+			{ 398, 1, 0 },
+			{ 399, 1, 0 },
+			{ 400, 1, 0 },
+			{ 401, 1, 0 },
+			{ 402, 0, 1980 },	// uacute
+			{ 402, 1, 0 },
+			{ 403, 1, 0 },
+			{ 404, 1, 0 },
+			{ 405, 0, 1984 },	// ucirc
+			{ 405, 1, 0 },
+			{ 406, 1, 0 },
+			{ 407, 1, 0 },
+			{ 408, 1, 0 },
+			{ 409, 0, 1991 },	// ugrave
+			{ 409, 1, 0 },
+			{ 410, 0, 2000 },	// uml
+			{ 410, 1, 0 },
+			{ 411, 1, 0 },
+			{ 412, 0, 2023 },	// uuml
+			{ 412, 3, 0 },
+			{ 415, 1, 0 },
+			{ 416, 1, 0 },
+			{ 417, 1, 0 },
+			{ 418, 1, 0 },
+			{ 419, 0, 2102 },	// yacute
+			{ 419, 1, 0 },
+			{ 420, 0, 2106 },	// yen
+			{ 420, 1, 0 },
+			{ 421, 1, 0 },
+			{ 422, 0, 2112 },	// yuml
+		};
+
+		inline constexpr legacy_edge legacy_edges[legacy_edge_count] =
+		{
+			{ 'A', 1 }, { 'C', 34 }, { 'E', 43 }, { 'G', 63 }, { 'I', 65 }, { 'L', 83 }, { 'N', 85 }, { 'O', 91 },
+			{ 'Q', 119 }, { 'R', 123 }, { 'T', 126 }, { 'U', 131 }, { 'Y', 149 }, { 'a', 155 }, { 'b', 191 }, { 'c', 197 },
+			{ 'd', 217 }, { 'e', 225 }, { 'f', 245 }, { 'g', 254 }, { 'i', 256 }, { 'l', 283 }, { 'm', 289 }, { 'n', 301 },
+			{ 'o', 312 }, { 'p', 344 }, { 'q', 357 }, { 'r', 361 }, { 's', 368 }, { 't', 383 }, { 'u', 392 }, { 'y', 412 },
+			{ 'E', 2 }, { 'M', 6 }, { 'a', 8 }, { 'c', 13 }, { 'g', 17 }, { 'r', 22 }, { 't', 26 }, { 'u', 31 },
+			{ 'l', 3 }, { 'i', 4 }, { 'g', 5 }, { 'P', 7 }, { 'c', 9 }, { 'u', 10 }, { 't', 11 }, { 'e', 12 },
+			{ 'i', 14 }, { 'r', 15 }, { 'c', 16 }, { 'r', 18 }, { 'a', 19 }, { 'v', 20 }, { 'e', 21 }, { 'i', 23 },
+			{ 'n', 24 }, { 'g', 25 }, { 'i', 27 }, { 'l', 28 }, { 'd', 29 }, { 'e', 30 }, { 'm', 32 }, { 'l', 33 },
+			{ 'O', 35 }, { 'c', 38 }, { 'P', 36 }, { 'Y', 37 }, { 'e', 39 }, { 'd', 40 }, { 'i', 41 }, { 'l', 42 },
+			{ 'T', 44 }, { 'a', 46 }, { 'c', 51 }, { 'g', 55 }, { 'u', 60 }, { 'H', 45 }, { 'c', 47 }, { 'u', 48 },
+			{ 't', 49 }, { 'e', 50 }, { 'i', 52 }, { 'r', 53 }, { 'c', 54 }, { 'r', 56 }, { 'a', 57 }, { 'v', 58 },
+			{ 'e', 59 }, { 'm', 61 }, { 'l', 62 }, { 'T', 64 }, { 'a', 66 }, { 'c', 71 }, { 'g', 75 }, { 'u', 80 },
+			{ 'c', 67 }, { 'u', 68 }, { 't', 69 }, { 'e', 70 }, { 'i', 72 }, { 'r', 73 }, { 'c', 74 }, { 'r', 76 },
+			{ 'a', 77 }, { 'v', 78 }, { 'e', 79 }, { 'm', 81 }, { 'l', 82 }, { 'T', 84 }, { 't', 86 }, { 'i', 87 },
+			{ 'l', 88 }, { 'd', 89 }, { 'e', 90 }, { 'a', 92 }, { 'c', 97 }, { 'g', 101 }, { 's', 106 }, { 't', 111 },
+			{ 'u', 116 }, { 'c', 93 }, { 'u', 94 }, { 't', 95 }, { 'e', 96 }, { 'i', 98 }, { 'r', 99 }, { 'c', 100 },
+			{ 'r', 102 }, { 'a', 103 }, { 'v', 104 }, { 'e', 105 }, { 'l', 107 }, { 'a', 108 }, { 's', 109 }, { 'h', 110 },
+			{ 'i', 112 }, { 'l', 113 }, { 'd', 114 }, { 'e', 115 }, { 'm', 117 }, { 'l', 118 }, { 'U', 120 }, { 'O', 121 },
+			{ 'T', 122 }, { 'E', 124 }, { 'G', 125 }, { 'H', 127 }, { 'O', 128 }, { 'R', 129 }, { 'N', 130 }, { 'a', 132 },
+			{ 'c', 137 }, { 'g', 141 }, { 'u', 146 }, { 'c', 133 }, { 'u', 134 }, { 't', 135 }, { 'e', 136 }, { 'i', 138 },
+			{ 'r', 139 }, { 'c', 140 }, { 'r', 142 }, { 'a', 143 }, { 'v', 144 }, { 'e', 145 }, { 'm', 147 }, { 'l', 148 },
+			{ 'a', 150 }, { 'c', 151 }, { 'u', 152 }, { 't', 153 }, { 'e', 154 }, { 'a', 156 }, { 'c', 161 }, { 'e', 168 },
+			{ 'g', 172 }, { 'm', 177 }, { 'r', 179 }, { 't', 183 }, { 'u', 188 }, { 'c', 157 }, { 'u', 158 }, { 't', 159 },
+			{ 'e', 160 }, { 'i', 162 }, { 'u', 165 }, { 'r', 163 }, { 'c', 164 }, { 't', 166 }, { 'e', 167 }, { 'l', 169 },
+			{ 'i', 170 }, { 'g', 171 }, { 'r', 173 }, { 'a', 174 }, { 'v', 175 }, { 'e', 176 }, { 'p', 178 }, { 'i', 180 },
+			{ 'n', 181 }, { 'g', 182 }, { 'i', 184 }, { 'l', 185 }, { 'd', 186 }, { 'e', 187 }, { 'm', 189 }, { 'l', 190 },
+			{ 'r', 192 }, { 'v', 193 }, { 'b', 194 }, { 'a', 195 }, { 'r', 196 }, { 'c', 198 }, { 'e', 203 }, { 'o', 209 },
+			{ 'u', 212 }, { 'e', 199 }, { 'd', 200 }, { 'i', 201 }, { 'l', 202 }, { 'd', 204 }, { 'n', 207 }, { 'i', 205 },
+			{ 'l', 206 }, { 't', 208 }, { 'p', 210 }, { 'y', 211 }, { 'r', 213 }, { 'r', 214 }, { 'e', 215 }, { 'n', 216 },
+			{ 'e', 218 }, { 'i', 220 }, { 'g', 219 }, { 'v', 221 }, { 'i', 222 }, { 'd', 223 }, { 'e', 224 }, { 'a', 226 },
+			{ 'c', 231 }, { 'g', 235 }, { 't', 240 }, { 'u', 242 }, { 'c', 227 }, { 'u', 228 }, { 't', 229 }, { 'e', 230 },
+			{ 'i', 232 }, { 'r', 233 }, { 'c', 234 }, { 'r', 236 }, { 'a', 237 }, { 'v', 238 }, { 'e', 239 }, { 'h', 241 },
+			{ 'm', 243 }, { 'l', 244 }, { 'r', 246 }, { 'a', 247 }, { 'c', 248 }, { '1', 249 }, { '3', 252 }, { '2', 250 },
+			{ '4', 251 }, { '4', 253 }, { 't', 255 }, { 'a', 257 }, { 'c', 262 }, { 'e', 266 }, { 'g', 270 }, { 'q', 275 },
+			{ 'u', 280 }, { 'c', 258 }, { 'u', 259 }, { 't', 260 }, { 'e', 261 }, { 'i', 263 }, { 'r', 264 }, { 'c', 265 },
+			{ 'x', 267 }, { 'c', 268 }, { 'l', 269 }, { 'r', 271 }, { 'a', 272 }, { 'v', 273 }, { 'e', 274 }, { 'u', 276 },
+			{ 'e', 277 }, { 's', 278 }, { 't', 279 }, { 'm', 281 }, { 'l', 282 }, { 'a', 284 }, { 't', 288 }, { 'q', 285 },
+			{ 'u', 286 }, { 'o', 287 }, { 'a', 290 }, { 'i', 293 }, { 'c', 291 }, { 'r', 292 }, { 'c', 294 }, { 'd', 297 },
+			{ 'r', 295 }, { 'o', 296 }, { 'd', 298 }, { 'o', 299 }, { 't', 300 }, { 'b', 302 }, { 'o', 305 }, { 't', 307 },
+			{ 's', 303 }, { 'p', 304 }, { 't', 306 }, { 'i', 308 }, { 'l', 309 }, { 'd', 310 }, { 'e', 311 }, { 'a', 313 },
+			{ 'c', 318 }, { 'g', 322 }, { 'r', 327 }, { 's', 331 }, { 't', 336 }, { 'u', 341 }, { 'c', 314 }, { 'u', 315 },
+			{ 't', 316 }, { 'e', 317 }, { 'i', 319 }, { 'r', 320 }, { 'c', 321 }, { 'r', 323 }, { 'a', 324 }, { 'v', 325 },
+			{ 'e', 326 }, { 'd', 328 }, { 'f', 329 }, { 'm', 330 }, { 'l', 332 }, { 'a', 333 }, { 's', 334 }, { 'h', 335 },
+			{ 'i', 337 }, { 'l', 338 }, { 'd', 339 }, { 'e', 340 }, { 'm', 342 }, { 'l', 343 }, { 'a', 345 }, { 'l', 348 },
+			{ 'o', 353 }, { 'r', 346 }, { 'a', 347 }, { 'u', 349 }, { 's', 350 }, { 'm', 351 }, { 'n', 352 }, { 'u', 354 },
+			{ 'n', 355 }, { 'd', 356 }, { 'u', 358 }, { 'o', 359 }, { 't', 360 }, { 'a', 362 }, { 'e', 366 }, { 'q', 363 },
+			{ 'u', 364 }, { 'o', 365 }, { 'g', 367 }, { 'e', 369 }, { 'h', 372 }, { 'u', 374 }, { 'z', 379 }, { 'c', 370 },
+			{ 't', 371 }, { 'y', 373 }, { 'p', 375 }, { '1', 376 }, { '2', 377 }, { '3', 378 }, { 'l', 380 }, { 'i', 381 },
+			{ 'g', 382 }, { 'h', 384 }, { 'i', 388 }, { 'o', 385 }, { 'r', 386 }, { 'n', 387 }, { 'm', 389 }, { 'e', 390 },
+			{ 's', 391 }, { 'a', 393 }, { 'c', 398 }, { 'g', 402 }, { 'm', 407 }, { 'u', 409 }, { 'c', 394 }, { 'u', 395 },
+			{ 't', 396 }, { 'e', 397 }, { 'i', 399 }, { 'r', 400 }, { 'c', 401 }, { 'r', 403 }, { 'a', 404 }, { 'v', 405 },
+			{ 'e', 406 }, { 'l', 408 }, { 'm', 410 }, { 'l', 411 }, { 'a', 413 }, { 'e', 418 }, { 'u', 420 }, { 'c', 414 },
+			{ 'u', 415 }, { 't', 416 }, { 'e', 417 }, { 'n', 419 }, { 'm', 421 }, { 'l', 422 },
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,86 @@
+// Decode time on inputs built to make a reference matcher rescan: runs of '&' ended by a single ';',
+// long alphanumeric names after every '&', and long digit runs after "&#". The matcher only reads
+// past engine::max_reference_length through digits or letters, which hold no other '&', so every
+// code unit is matched at most once and time per byte must not grow with size.
+//
+//   bench_adversarial [--quick]
+//
+// Fails when the time per byte at the largest size exceeds four times that at the smallest.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "html_entities_decoder.hpp"
+
+namespace
+{
+	struct adversarial_input
+	{
+		const char *name;
+		std::string (*make)(std::size_t size);
+	};
+
+	std::string ampersands_then_semicolon(std::size_t size)
+	{
+		std::string text(size - 1, '&');
+		return text + ";";
+	}
+
+	std::string long_names(std::size_t size)
+	{
+		return benchmark::repeat("&CounterClockwiseContourIntegralCounterClockwiseContourIntegralX", size - 1) + ";";
+	}
+
+	std::string long_digit_runs(std::size_t size)
+	{
+		return benchmark::repeat("&#" + std::string(200, '9'), size - 1) + ";";
+	}
+}
+
+int main(int argc, char **argv)
+{
+	bool quick = benchmark::has_flag(argc, argv, "--quick");
+	std::vector<std::size_t> sizes = quick ? std::vector<std::size_t>{ 1 << 16, 1 << 19 } : std::vector<std::size_t>{ 1 << 16, 1 << 18, 1 << 20, 1 << 22 };
+	const adversarial_input inputs[] =
+	{
+		{ "'&' x N then ';'", ampersands_then_semicolon },
+		{ "'&' + long names", long_names },
+		{ "'&#' + long digits", long_digit_runs },
+	};
+
+	const html_entities_decoder::html_entities_decoder decoder;
+	bool linear = true;
+	for (const adversarial_input &input : inputs)
+	{
+		std::cout << input.name << "\n";
+		double first_rate = 0;
+		double last_rate = 0;
+		for (std::size_t size : sizes)
+		{
+			std::string text = input.make(size);
+			std::string output;
+			double seconds = benchmark::measure([&]
+			{
+				output.clear();
+				decoder.decode_html_entities_append(std::string_view(text), output);
+			}, 5);
+			double nanoseconds_per_byte = seconds * 1e9 / static_cast<double>(text.size());
+			std::cout << "  " << std::setw(9) << text.size() << " bytes  " << std::fixed << std::setprecision(2) << nanoseconds_per_byte << " ns/byte\n";
+			if (size == sizes.front())
+				first_rate = nanoseconds_per_byte;
+			last_rate = nanoseconds_per_byte;
+		}
+		if (last_rate > first_rate * 4)
+			linear = false;
+	}
+
+	if (!linear)
+	{
+		std::cerr << "time per byte grows with input size\n";
+		return 1;
+	}
+	return 0;
+}
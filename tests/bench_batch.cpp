@@ -0,0 +1,81 @@
+// Items per second for decode_html_entities_batch() on many short strings, against decoding every
+// item into a std::string of its own, with 1, 2, 4, ... up to N threads.
+//
+//   bench_batch [max_threads] [--quick]
+//
+// max_threads defaults to the number of hardware threads. --quick decodes 20000 items with at most
+// 4 threads. Fails when a batch differs from decoding the items one by one.
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "html_entities_decoder.hpp"
+
+int main(int argc, char **argv)
+{
+	unsigned max_threads = std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1;
+	for (int index = 1; index < argc; ++index)
+	{
+		if (argv[index][0] != '-')
+			max_threads = static_cast<unsigned>(std::atoi(argv[index]));
+	}
+	bool quick = benchmark::has_flag(argc, argv, "--quick");
+	if (quick && max_threads > 4)
+		max_threads = 4;
+
+	// Short strings of different lengths, like the titles or names of a database column
+	const char *const samples[] =
+	{
+		"Caf&eacute; &amp; Bar",
+		"Fish &amp; Chips &ndash; &pound;8",
+		"plain name without references",
+		"&lt;b&gt;Bold&lt;/b&gt; claims &amp; &quot;quotes&quot;",
+		"Cr&egrave;me br&ucirc;l&eacute;e &#8364;3 &#x1F600;",
+		"x",
+	};
+	const std::size_t item_count = quick ? 20000 : 2000000;
+	std::vector<std::string> strings;
+	strings.reserve(item_count);
+	for (std::size_t index = 0; index < item_count; ++index)
+		strings.push_back(std::string(samples[index % std::size(samples)]) + " #" + std::to_string(index));
+	std::vector<std::string_view> items(strings.begin(), strings.end());
+
+	const html_entities_decoder::html_entities_decoder decoder;
+	const int repetitions = quick ? 3 : 5;
+
+	std::vector<std::string> expected(item_count);
+	double separate_seconds = benchmark::measure([&]
+	{
+		for (std::size_t index = 0; index < item_count; ++index)
+			expected[index] = decoder.decode_html_entities(items[index]);
+	}, repetitions);
+	std::cout << "one string per item  " << std::setw(8) << std::fixed << std::setprecision(2) << item_count / separate_seconds / 1e6 << " M items/s\n";
+
+	bool identical = true;
+	html_entities_decoder::decoded_batch<char> batch;
+	for (unsigned thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+	{
+		double seconds = benchmark::measure([&]
+		{
+			decoder.decode_html_entities_batch(items.data(), items.size(), batch, thread_count);
+		}, repetitions);
+		for (std::size_t index = 0; index < item_count; ++index)
+		{
+			if (batch[index] != expected[index])
+				identical = false;
+		}
+		std::cout << "batch, " << std::setw(2) << thread_count << " threads     " << std::setw(8) << item_count / seconds / 1e6 << " M items/s\n";
+	}
+
+	if (!identical)
+	{
+		std::cerr << "batch differs from decoding the items one by one\n";
+		return 1;
+	}
+	return 0;
+}
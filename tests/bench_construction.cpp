@@ -0,0 +1,58 @@
+// Cost of constructing a decoder: constructing one for every short string decoded against reusing a
+// single instance. The decoder only holds its options and the entity table is constant-initialized,
+// so both must take about the same time.
+//
+//   bench_construction [--quick]
+//
+// Fails when constructing a decoder per call is more than 25% slower than reusing one.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "benchmark.hpp"
+#include "html_entities_decoder.hpp"
+
+int main(int argc, char **argv)
+{
+	bool quick = benchmark::has_flag(argc, argv, "--quick");
+	const int decodes = quick ? 200000 : 5000000;
+	const std::string input = "Caf&eacute; &amp; cr&egrave;me";
+
+	std::string output;
+	std::size_t total_length = 0;
+	double constructed_seconds = benchmark::measure([&]
+	{
+		for (int decode = 0; decode < decodes; ++decode)
+		{
+			html_entities_decoder::html_entities_decoder decoder;
+			output.clear();
+			decoder.decode_html_entities_append(std::string_view(input), output);
+			total_length += output.size();
+		}
+	}, 5);
+
+	const html_entities_decoder::html_entities_decoder shared_decoder;
+	double reused_seconds = benchmark::measure([&]
+	{
+		for (int decode = 0; decode < decodes; ++decode)
+		{
+			output.clear();
+			shared_decoder.decode_html_entities_append(std::string_view(input), output);
+			total_length += output.size();
+		}
+	}, 5);
+
+	double constructed_ns = constructed_seconds * 1e9 / decodes;
+	double reused_ns = reused_seconds * 1e9 / decodes;
+	std::cout << "construct + decode  " << std::fixed << std::setprecision(1) << std::setw(7) << constructed_ns << " ns\n";
+	std::cout << "reuse one decoder   " << std::setw(7) << reused_ns << " ns\n";
+	std::cout << "(" << total_length << " code units decoded)\n";
+
+	if (constructed_ns > reused_ns * 1.25)
+	{
+		std::cerr << "constructing a decoder is not free\n";
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,78 @@
+// decoded_length() against a full decode of the same input. decoded_length() matches every
+// reference but builds no value and writes nothing. Matching takes most of the time of both, so the
+// speedup stays below the 2x that was aimed for: about 1.5x to 2x, depending on the input.
+//
+//   bench_decoded_length [--quick]
+//
+// --quick uses 1 MB inputs instead of 50 MB. Fails when a length differs from the full decode, or
+// when decoded_length() over all inputs together is less than 1.25x faster than a full decode.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "benchmark.hpp"
+#include "html_entities_decoder.hpp"
+
+namespace
+{
+	struct length_input
+	{
+		const char *name;
+		const char *pattern;
+	};
+}
+
+int main(int argc, char **argv)
+{
+	bool quick = benchmark::has_flag(argc, argv, "--quick");
+	const std::size_t size = quick ? 1000000 : 50000000;
+	const length_input inputs[] =
+	{
+		{ "prose, 1 reference / 70 bytes", "The caf&eacute; on the corner serves coffee, tea and cakes every day. " },
+		{ "markup, 1 reference / 12 bytes", "<p>Caf&eacute; &amp; cr&egrave;me br&ucirc;l&eacute;e &#8364;3 &lt;b&gt; &#x1F600; plain text without references here.</p>\n" },
+		{ "dense, 1 reference / 6 bytes", "a&amp;b&lt;c " },
+	};
+
+	const html_entities_decoder::html_entities_decoder decoder;
+	double total_decode_seconds = 0;
+	double total_length_seconds = 0;
+	bool identical = true;
+	std::cout << "input                            decode ms  length ms  speedup\n";
+	for (const length_input &input : inputs)
+	{
+		std::string text = benchmark::repeat(input.pattern, size);
+		std::string output;
+		std::size_t length = 0;
+		double decode_seconds = benchmark::measure([&]
+		{
+			output.clear();
+			decoder.decode_html_entities_append(std::string_view(text), output);
+		}, quick ? 15 : 7);
+		double length_seconds = benchmark::measure([&]
+		{
+			length = decoder.decoded_length(std::string_view(text));
+		}, quick ? 15 : 7);
+		if (length != output.size())
+			identical = false;
+
+		total_decode_seconds += decode_seconds;
+		total_length_seconds += length_seconds;
+		double speedup = decode_seconds / length_seconds;
+		std::cout << std::left << std::setw(33) << input.name << std::right << std::fixed << std::setprecision(2)
+			<< std::setw(9) << decode_seconds * 1e3 << "  " << std::setw(9) << length_seconds * 1e3 << "  " << std::setw(7) << speedup << "\n";
+	}
+
+	if (!identical)
+	{
+		std::cerr << "decoded_length() differs from the length of a full decode\n";
+		return 1;
+	}
+	std::cout << "all inputs: " << std::setprecision(2) << total_decode_seconds / total_length_seconds << "x\n";
+	if (total_decode_seconds < total_length_seconds * 1.25)
+	{
+		std::cerr << "decoded_length() is not fast enough compared with a full decode\n";
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,52 @@
+// Decode time of "&amp;"-dense input from 1 KB to 100 MB. The decoder appends unchanged runs and
+// values to one output in a single pass, so time per byte must stay flat as the input grows.
+//
+//   bench_linear_scaling [--quick]
+//
+// --quick stops at 1 MB. Fails when the time per byte at the largest size exceeds four times the
+// best time per byte seen at any size.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "benchmark.hpp"
+#include "html_entities_decoder.hpp"
+
+int main(int argc, char **argv)
+{
+	bool quick = benchmark::has_flag(argc, argv, "--quick");
+	std::size_t largest = quick ? 1000000 : 100000000;
+
+	const html_entities_decoder::html_entities_decoder decoder;
+	double best_rate = 0;
+	double last_rate = 0;
+	std::cout << "     bytes  ns/byte\n";
+	for (std::size_t size = 1000; size <= largest; size *= 10)
+	{
+		std::string text = benchmark::repeat("&amp;x&amp;&amp;", size);
+		std::string output;
+		int repetitions = size >= 10000000 ? 3 : 7;
+		int decodes = size >= 1000000 ? 1 : static_cast<int>(1000000 / size);
+		double seconds = benchmark::measure([&]
+		{
+			for (int decode = 0; decode < decodes; ++decode)
+			{
+				output.clear();
+				decoder.decode_html_entities_append(std::string_view(text), output);
+			}
+		}, repetitions);
+
+		last_rate = seconds * 1e9 / static_cast<double>(size) / decodes;
+		if (best_rate == 0 || last_rate < best_rate)
+			best_rate = last_rate;
+		std::cout << std::setw(10) << size << "  " << std::fixed << std::setprecision(2) << last_rate << "\n";
+	}
+
+	if (last_rate > best_rate * 4)
+	{
+		std::cerr << "time per byte grows with input size\n";
+		return 1;
+	}
+	return 0;
+}
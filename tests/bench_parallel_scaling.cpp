@@ -0,0 +1,62 @@
+// Speedup of decode_html_entities_parallel() over decode_html_entities() with 1, 2, 4, ... up to N threads
+// on one large input. Every chunk is decoded once, so the work per thread shrinks as threads are added.
+//
+//   bench_parallel_scaling [max_threads] [--quick]
+//
+// max_threads defaults to 32. --quick stops at 4 threads on a 1 MB input. Fails when a result differs
+// from decode_html_entities().
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "benchmark.hpp"
+#include "html_entities_decoder.hpp"
+
+int main(int argc, char **argv)
+{
+	unsigned max_threads = 32;
+	for (int index = 1; index < argc; ++index)
+	{
+		if (argv[index][0] != '-')
+			max_threads = static_cast<unsigned>(std::atoi(argv[index]));
+	}
+	bool quick = benchmark::has_flag(argc, argv, "--quick");
+	if (quick && max_threads > 4)
+		max_threads = 4;
+
+	const html_entities_decoder::html_entities_decoder decoder;
+	const std::string input = benchmark::mixed_text(quick ? (1 << 20) : (1 << 27));
+	const int repetitions = quick ? 3 : 5;
+
+	std::string expected;
+	double single_thread_seconds = benchmark::measure([&]
+	{
+		expected = decoder.decode_html_entities(input);
+	}, repetitions);
+
+	std::cout << "threads  MB/s      speedup\n";
+	bool identical = true;
+	for (unsigned thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+	{
+		std::string output;
+		double seconds = benchmark::measure([&]
+		{
+			output = decoder.decode_html_entities_parallel(std::string_view(input), thread_count);
+		}, repetitions);
+		if (output != expected)
+			identical = false;
+
+		double rate = static_cast<double>(input.size()) / seconds / 1e6;
+		std::cout << std::setw(7) << thread_count << "  " << std::setw(8) << std::fixed << std::setprecision(1) << rate
+			<< "  " << std::setw(7) << std::setprecision(2) << single_thread_seconds / seconds << "\n";
+	}
+
+	if (!identical)
+	{
+		std::cerr << "parallel result differs from decode_html_entities()\n";
+		return 1;
+	}
+	return 0;
+}
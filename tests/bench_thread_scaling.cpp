@@ -0,0 +1,84 @@
+// Throughput of 1 to N threads decoding through one shared html_entities_decoder.
+//
+//   bench_thread_scaling [max_threads] [--quick] [--min-efficiency=0.8]
+//
+// max_threads defaults to the number of hardware threads. With --min-efficiency the program fails
+// when any thread count up to the number of hardware threads scales worse than that fraction of linear.
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "html_entities_decoder.hpp"
+
+int main(int argc, char **argv)
+{
+	unsigned hardware_threads = std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1;
+	unsigned max_threads = hardware_threads;
+	double min_efficiency = 0;
+	for (int index = 1; index < argc; ++index)
+	{
+		if (std::strncmp(argv[index], "--min-efficiency=", 17) == 0)
+			min_efficiency = std::atof(argv[index] + 17);
+		else if (argv[index][0] != '-')
+			max_threads = static_cast<unsigned>(std::atoi(argv[index]));
+	}
+	bool quick = benchmark::has_flag(argc, argv, "--quick");
+	if (quick && max_threads > 4)
+		max_threads = 4;
+
+	const html_entities_decoder::html_entities_decoder decoder;
+	const std::string input = benchmark::mixed_text(quick ? (1 << 16) : (1 << 22));
+	const int decodes_per_thread = quick ? 4 : 32;
+
+	std::cout << "threads  MB/s      speedup  efficiency\n";
+	double single_thread_rate = 0;
+	bool scaled = true;
+	for (unsigned thread_count = 1; thread_count <= max_threads; ++thread_count)
+	{
+		double seconds = benchmark::measure([&]
+		{
+			std::atomic<bool> start{ false };
+			std::vector<std::thread> threads;
+			for (unsigned thread_index = 0; thread_index < thread_count; ++thread_index)
+			{
+				threads.emplace_back([&]
+				{
+					while (!start.load())
+						std::this_thread::yield();
+					std::string output;
+					for (int decode = 0; decode < decodes_per_thread; ++decode)
+					{
+						output.clear();
+						decoder.decode_html_entities_append(std::string_view(input), output);
+					}
+				});
+			}
+			start = true;
+			for (std::thread &thread : threads)
+				thread.join();
+		});
+
+		double rate = static_cast<double>(input.size()) * decodes_per_thread * thread_count / seconds / 1e6;
+		if (thread_count == 1)
+			single_thread_rate = rate;
+		double efficiency = rate / single_thread_rate / thread_count;
+		std::cout << std::setw(7) << thread_count << "  " << std::setw(8) << std::fixed << std::setprecision(1) << rate
+			<< "  " << std::setw(7) << std::setprecision(2) << rate / single_thread_rate << "  " << std::setw(10) << efficiency << "\n";
+		if (thread_count <= hardware_threads && efficiency < min_efficiency)
+			scaled = false;
+	}
+
+	if (!scaled)
+	{
+		std::cerr << "scaling fell below " << min_efficiency << " of linear\n";
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef __HTML_ENTITIES_DECODER_BENCHMARK__
+#define __HTML_ENTITIES_DECODER_BENCHMARK__
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace benchmark
+{
+	// Best of `repetitions` runs, in seconds
+	template <typename Function>
+	double measure(Function &&function, int repetitions = 3)
+	{
+		double best = 0;
+		for (int run = 0; run < repetitions; ++run)
+		{
+			auto start = std::chrono::steady_clock::now();
+			function();
+			double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			if (run == 0 || elapsed < best)
+				best = elapsed;
+		}
+		return best;
+	}
+
+	// `pattern` repeated up to exactly `size` code units
+	inline std::string repeat(const std::string &pattern, std::size_t size)
+	{
+		std::string text;
+		text.reserve(size);
+		while (text.size() + pattern.size() <= size)
+			text += pattern;
+		text.append(pattern, 0, size - text.size());
+		return text;
+	}
+
+	// Ordinary markup text with a few references of every kind
+	inline std::string mixed_text(std::size_t size)
+	{
+		return repeat("<p>Caf&eacute; &amp; cr&egrave;me br&ucirc;l&eacute;e &#8364;3 &lt;b&gt; &#x1F600; plain text without references here.</p>\n", size);
+	}
+
+	inline bool has_flag(int argc, char **argv, const char *flag)
+	{
+		for (int index = 1; index < argc; ++index)
+		{
+			if (std::strcmp(argv[index], flag) == 0)
+				return true;
+		}
+		return false;
+	}
+}
+
+#endif
@@ -0,0 +1,114 @@
+// decode_in_place() on strings and raw buffers must give exactly what decode_html_entities() gives:
+// shrinking and growing references, exact and short capacities, and long unchanged tails after a
+// growing reference, which pass through the side buffer block by block.
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "html_entities_decoder.hpp"
+
+namespace
+{
+	const html_entities_decoder::html_entities_decoder decoder;
+	int failures = 0;
+
+	void fail(const char *what, const std::string &input)
+	{
+		if (++failures <= 10)
+			std::cerr << what << " differs for \"" << input.substr(0, 80) << (input.size() > 80 ? "...\"" : "\"") << " (" << input.size() << " units)\n";
+	}
+
+	template <typename CharT>
+	void check(const std::string &narrow_input)
+	{
+		using string_type = std::basic_string<CharT>;
+		string_type input(narrow_input.begin(), narrow_input.end());
+		string_type expected;
+		html_entities_decoder::decode_result expected_result = decoder.try_decode_html_entities(std::basic_string_view<CharT>(input), expected);
+
+		string_type text = input;
+		html_entities_decoder::decode_result result = decoder.decode_in_place(text);
+		if (text != expected || result.length != expected.size() || result.malformed_references != expected_result.malformed_references)
+			fail("decode_in_place(string)", narrow_input);
+
+		// Room for the whole result, exactly
+		std::size_t capacity = expected.size() > input.size() ? expected.size() : input.size();
+		std::vector<CharT> buffer(input.begin(), input.end());
+		buffer.resize(capacity);
+		result = decoder.decode_in_place(buffer.data(), input.size(), capacity);
+		if (result.status != html_entities_decoder::decode_status::ok || result.length != expected.size() ||
+			string_type(buffer.data(), result.length) != expected || result.malformed_references != expected_result.malformed_references)
+			fail("decode_in_place(data, length, exact capacity)", narrow_input);
+
+		// One unit short: the decoded prefix that fits, and the length that is needed
+		if (expected.size() > input.size())
+		{
+			buffer.assign(input.begin(), input.end());
+			buffer.resize(expected.size() - 1);
+			result = decoder.decode_in_place(buffer.data(), input.size(), expected.size() - 1);
+			if (result.status != html_entities_decoder::decode_status::buffer_too_small || result.length != expected.size() ||
+				string_type(buffer.data(), buffer.size()) != expected.substr(0, buffer.size()))
+				fail("decode_in_place(data, length, short capacity)", narrow_input);
+		}
+
+		// A capacity below the input length is taken as the input length
+		std::vector<CharT> input_only(input.begin(), input.end());
+		result = decoder.decode_in_place(input_only.data(), input.size(), input.size() / 2);
+		std::size_t written = expected.size() < input.size() ? expected.size() : input.size();
+		if (result.length != expected.size() || string_type(input_only.data(), written) != expected.substr(0, written))
+			fail("decode_in_place(data, length, capacity < length)", narrow_input);
+	}
+
+	void check_all(const std::string &input)
+	{
+		check<char>(input);
+		check<char16_t>(input);
+		check<char32_t>(input);
+		check<wchar_t>(input);
+	}
+}
+
+int main()
+{
+	// Shrinking, growing ("&nGt;" is 6 UTF-8 units, 2 UTF-16 units) and mixed
+	check_all("&amp;&lt;&gt; plain &quot;text&quot; &copy &#65;&#x42;");
+	check_all("&nGt;&nGt;&nGt;");
+	check_all("&nGt;&amp;&nGt;&lt;x&nLt;&#x1F600;&NotNestedGreaterGreater;&bogus; &");
+	check_all("");
+	check_all("no references");
+
+	// Long unchanged tails after growing references
+	std::string tail;
+	for (int index = 0; index < 5000; ++index)
+		tail += static_cast<char>('a' + index % 26);
+	check_all("&nGt;" + tail);
+	check_all("&nGt;&nGt;&nGt;" + tail + "&amp;" + tail + "&nGt;" + tail);
+	std::string growing;
+	for (int index = 0; index < 2000; ++index)
+		growing += "&nGt;";
+	check_all(growing + tail + "&lt;" + tail);
+
+	// Random mixes
+	const char *const parts[] = { "&amp;", "&nGt;", "&nLt;", "&#x1F600;", "&copy", "text ", "&bogus;", "&#", "&", "\xC3\xA9", "&#128;", "&lt", "x" };
+	std::mt19937 random(2024);
+	for (int round = 0; round < 3000; ++round)
+	{
+		std::string input;
+		int part_count = static_cast<int>(random() % 24);
+		for (int part = 0; part < part_count; ++part)
+			input += parts[random() % std::size(parts)];
+		if (round % 100 == 0)
+			input += tail;
+		check_all(input);
+	}
+
+	if (failures != 0)
+	{
+		std::cerr << failures << " in-place results differ from decode_html_entities()\n";
+		return 1;
+	}
+	std::cout << "decode_in_place matches decode_html_entities\n";
+	return 0;
+}
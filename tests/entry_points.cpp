@@ -0,0 +1,186 @@
+// Every way of decoding besides decode_html_entities() must give the same text and malformed count:
+// scatter-gather slices, Arrow-style columns, segmented input, html_entities_streambuf when reading
+// and when writing, and in C++20 views::decoded.
+
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "html_entities_decoder.hpp"
+
+namespace
+{
+	const char *const samples[] =
+	{
+		"",
+		"plain text without references",
+		"&amp;&lt;&gt;&quot;&apos;&nbsp;&copy;&reg;",
+		"Caf&eacute; cr&egrave;me &#8364;3 &#x1F600; &#128; &#0; &#xD800; &#x110000;",
+		"&copy &notit; &notin; &amp= &ampx &bogus; &#; &#x; & &&& &#65",
+		"&Longleftrightarrow;&nGt;&NotNestedGreaterGreater;&fjlig;&CounterClockwiseContourIntegral;",
+		"&#000000000000000000000000000000000000065;&#x00000000000000000000000000000000000041;x",
+		"&aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa; &bbbbbbbbbbbbbbbbbbbbbbbbbbbbbb",
+		"\xC3\xA9t\xC3\xA9 &amp; \xE2\x82\xAC &#x20AC;&",
+	};
+
+	int failures = 0;
+
+	void fail(const char *entry_point, const std::string &input)
+	{
+		if (++failures <= 10)
+			std::cerr << entry_point << " differs for \"" << input << "\"\n";
+	}
+
+	std::string read_through_streambuf(const html_entities_decoder::decoder_options &options, const std::string &input, std::size_t buffer_size)
+	{
+		std::stringbuf source(input);
+		html_entities_decoder::html_entities_streambuf decoding(&source, options, buffer_size);
+		return std::string(std::istreambuf_iterator<char>(&decoding), std::istreambuf_iterator<char>());
+	}
+
+	std::string write_through_streambuf(const html_entities_decoder::decoder_options &options, const std::string &input, std::size_t piece_size)
+	{
+		std::stringbuf target;
+		{
+			html_entities_decoder::html_entities_streambuf decoding(&target, options, 64);
+			std::ostream stream(&decoding);
+			for (std::size_t start = 0; start < input.size(); start += piece_size)
+				stream << input.substr(start, piece_size);
+			stream.flush();
+			if (!decoding.finish())
+				return "<finish failed>";
+		}
+		return target.str();
+	}
+
+	void check_document(const html_entities_decoder::decoder_options &options, const std::string &input)
+	{
+		const html_entities_decoder::html_entities_decoder decoder(options);
+		std::string expected;
+		std::size_t expected_malformed = decoder.try_decode_html_entities(std::string_view(input), expected).malformed_references;
+
+		html_entities_decoder::decoded_slices<char> slices;
+		html_entities_decoder::decode_result result = decoder.decode_html_entities_slices(std::string_view(input), slices);
+		std::string gathered;
+		for (const html_entities_decoder::decoded_slice<char> &slice : slices)
+			gathered.append(slice.data, slice.length);
+		if (gathered != expected || slices.length() != expected.size() || result.malformed_references != expected_malformed)
+			fail("decode_html_entities_slices", input);
+
+		std::u16string input16(input.begin(), input.end());
+		std::u16string expected16 = decoder.decode_html_entities(input16);
+		html_entities_decoder::decoded_slices<char16_t> slices16 = decoder.decode_html_entities_slices(std::u16string_view(input16));
+		std::u16string gathered16;
+		for (const html_entities_decoder::decoded_slice<char16_t> &slice : slices16)
+			gathered16.append(slice.data, slice.length);
+		if (gathered16 != expected16)
+			fail("decode_html_entities_slices (UTF-16)", input);
+
+		for (std::size_t segment_size : { std::size_t(1), std::size_t(3), std::size_t(7), input.size() + 1 })
+		{
+			std::vector<std::string_view> segments;
+			for (std::size_t start = 0; start < input.size(); start += segment_size)
+				segments.push_back(std::string_view(input).substr(start, segment_size));
+			std::string output;
+			result = decoder.decode_html_entities_segments(segments.begin(), segments.end(), output);
+			if (output != expected || result.malformed_references != expected_malformed)
+				fail("decode_html_entities_segments", input);
+		}
+
+		for (std::size_t buffer_size : { std::size_t(1), std::size_t(40), std::size_t(4096) })
+		{
+			if (read_through_streambuf(options, input, buffer_size) != expected)
+				fail("html_entities_streambuf (reading)", input);
+		}
+		for (std::size_t piece_size : { std::size_t(1), std::size_t(5), input.size() + 1 })
+		{
+			if (write_through_streambuf(options, input, piece_size) != expected)
+				fail("html_entities_streambuf (writing)", input);
+		}
+
+#if __cplusplus >= 202002L
+		std::string viewed;
+		for (char ch : std::string_view(input) | html_entities_decoder::views::decoded(options))
+			viewed += ch;
+		if (viewed != expected)
+			fail("views::decoded", input);
+
+		std::list<char> linked(input.begin(), input.end());
+		viewed.clear();
+		for (char ch : linked | html_entities_decoder::views::decoded(options))
+			viewed += ch;
+		if (viewed != expected)
+			fail("views::decoded (std::list)", input);
+#endif
+	}
+
+	template <typename Offset>
+	void check_column(const html_entities_decoder::decoder_options &options, const std::vector<std::string> &rows)
+	{
+		const html_entities_decoder::html_entities_decoder decoder(options);
+		std::string data;
+		std::vector<Offset> offsets(1, 0);
+		std::size_t expected_malformed = 0;
+		for (const std::string &row : rows)
+		{
+			data += row;
+			offsets.push_back(static_cast<Offset>(data.size()));
+			std::string ignored;
+			expected_malformed += decoder.try_decode_html_entities(std::string_view(row), ignored).malformed_references;
+		}
+
+		std::string output_data;
+		std::vector<Offset> output_offsets;
+		html_entities_decoder::decode_result result = decoder.decode_html_entities_column(data.data(), offsets.data(), rows.size(), output_data, output_offsets);
+		bool identical = result.status == html_entities_decoder::decode_status::ok && output_offsets.size() == rows.size() + 1 &&
+			result.malformed_references == expected_malformed && static_cast<std::size_t>(output_offsets.back()) == output_data.size();
+		for (std::size_t row = 0; identical && row < rows.size(); ++row)
+		{
+			if (output_data.substr(output_offsets[row], output_offsets[row + 1] - output_offsets[row]) != decoder.decode_html_entities(rows[row]))
+				identical = false;
+		}
+		if (!identical)
+			fail(sizeof(Offset) == 4 ? "decode_html_entities_column (32-bit offsets)" : "decode_html_entities_column (64-bit offsets)", data.substr(0, 80));
+	}
+}
+
+int main()
+{
+	html_entities_decoder::decoder_options attribute_options;
+	attribute_options.attribute_value = true;
+	const html_entities_decoder::decoder_options all_options[] = { html_entities_decoder::decoder_options(), attribute_options };
+
+	// The samples, and random mixes of their parts
+	std::vector<std::string> documents(std::begin(samples), std::end(samples));
+	const char *const parts[] = { "&amp;", "&nGt;", "&#x1F600;", "&copy", "text ", "&bogus;", "&#", "&", "\xC3\xA9", "&#128;", "&lt", "&notin", "0", ";", "x" };
+	std::mt19937 random(7);
+	for (int document = 0; document < 300; ++document)
+	{
+		std::string text;
+		int part_count = static_cast<int>(random() % 16);
+		for (int part = 0; part < part_count; ++part)
+			text += parts[random() % std::size(parts)];
+		documents.push_back(text);
+	}
+
+	for (const html_entities_decoder::decoder_options &options : all_options)
+	{
+		for (const std::string &document : documents)
+			check_document(options, document);
+		check_column<std::int32_t>(options, documents);
+		check_column<std::int64_t>(options, documents);
+	}
+
+	if (failures != 0)
+	{
+		std::cerr << failures << " results differ from decode_html_entities()\n";
+		return 1;
+	}
+	std::cout << "all entry points match decode_html_entities\n";
+	return 0;
+}
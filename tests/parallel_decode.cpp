@@ -0,0 +1,50 @@
+// decode_html_entities_parallel() must give what decode_html_entities() gives when a chunk boundary
+// falls inside a reference, including numeric references with long runs of leading zeros, which
+// reach further back than any named reference.
+
+#include <iostream>
+#include <string>
+
+#include "html_entities_decoder.hpp"
+
+int main()
+{
+	const html_entities_decoder::html_entities_decoder decoder;
+	const unsigned thread_count = 4;
+	const std::size_t size = html_entities_decoder::engine::parallel_chunk_minimum * thread_count;
+	const std::string references[] =
+	{
+		"&#" + std::string(100, '0') + "65;",
+		"&#x" + std::string(100, '0') + "1F600;",
+		"&#X" + std::string(60, '0') + "41",
+		"&CounterClockwiseContourIntegral;",
+		"&notin;",
+		"&amp",
+	};
+
+	int failures = 0;
+	for (const std::string &reference : references)
+	{
+		// The reference starts `shift` units before every chunk boundary
+		for (std::size_t shift = 0; shift <= reference.size(); ++shift)
+		{
+			std::string input(size, 'a');
+			for (unsigned chunk = 1; chunk < thread_count; ++chunk)
+				input.replace(size / thread_count * chunk - shift, reference.size(), reference);
+
+			if (decoder.decode_html_entities_parallel(std::string_view(input), thread_count) != decoder.decode_html_entities(input))
+			{
+				if (++failures <= 10)
+					std::cerr << "\"" << reference << "\" starting " << shift << " units before a chunk boundary\n";
+			}
+		}
+	}
+
+	if (failures != 0)
+	{
+		std::cerr << failures << " parallel results differ from decode_html_entities()\n";
+		return 1;
+	}
+	std::cout << "parallel decoding matches decode_html_entities across chunk boundaries\n";
+	return 0;
+}
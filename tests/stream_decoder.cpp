@@ -0,0 +1,110 @@
+// html_entities_stream_decoder must give the text and malformed count of decoding the whole document
+// at once, wherever the document is split: at every offset, at every pair of offsets, and one code
+// unit at a time.
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "html_entities_decoder.hpp"
+
+namespace
+{
+	const char *const documents[] =
+	{
+		"plain text without references",
+		"&amp;&lt;&gt;&quot;&apos;&nbsp;&copy;&reg;",
+		"Caf&eacute; cr&egrave;me &#8364;3 &#x1F600; &#128; &#0; &#xD800; &#x110000;",
+		"&copy &notit; &notin; &amp= &ampx &bogus; &#; &#x; & &&& &#65",
+		"&Longleftrightarrow;&nGt;&NotNestedGreaterGreater;&fjlig;&CounterClockwiseContourIntegral;",
+		"&#000000000000000000000000000000000000065;&#x00000000000000000000000000000000000041;x",
+		"&#00000000000000000000000000000000000000000000000000000000000000000000065",
+		"&aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa; &bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb",
+		"&ampaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa;&",
+		"&#x",
+		"&",
+	};
+
+	int failures = 0;
+
+	struct decoded
+	{
+		std::string text;
+		std::size_t malformed_references = 0;
+	};
+
+	decoded decode_pieces(const html_entities_decoder::decoder_options &options, const std::string &document, const std::vector<std::size_t> &splits)
+	{
+		html_entities_decoder::html_entities_stream_decoder<char> stream_decoder(options);
+		decoded result;
+		std::size_t start = 0;
+		for (std::size_t split : splits)
+		{
+			result.malformed_references += stream_decoder.feed(std::string_view(document).substr(start, split - start), result.text).malformed_references;
+			start = split;
+		}
+		result.malformed_references += stream_decoder.feed(std::string_view(document).substr(start), result.text).malformed_references;
+		result.malformed_references += stream_decoder.finish(result.text).malformed_references;
+		return result;
+	}
+
+	void check(const html_entities_decoder::decoder_options &options, const std::string &document, const decoded &expected, const std::vector<std::size_t> &splits)
+	{
+		decoded result = decode_pieces(options, document, splits);
+		if (result.text == expected.text && result.malformed_references == expected.malformed_references)
+			return;
+		if (++failures <= 10)
+		{
+			std::cerr << "\"" << document << "\" split at";
+			for (std::size_t split : splits)
+				std::cerr << " " << split;
+			std::cerr << ": \"" << result.text << "\" (" << result.malformed_references << " malformed), expected \"" << expected.text << "\" (" << expected.malformed_references << ")\n";
+		}
+	}
+}
+
+int main()
+{
+	html_entities_decoder::decoder_options attribute_options;
+	attribute_options.attribute_value = true;
+	const html_entities_decoder::decoder_options all_options[] = { html_entities_decoder::decoder_options(), attribute_options };
+
+	std::vector<std::string> inputs(std::begin(documents), std::end(documents));
+	std::string joined;
+	for (const char *document : documents)
+		joined += document;
+	inputs.push_back(joined);
+
+	for (const html_entities_decoder::decoder_options &options : all_options)
+	{
+		const html_entities_decoder::html_entities_decoder decoder(options);
+		for (const std::string &document : inputs)
+		{
+			decoded expected;
+			expected.malformed_references = decoder.try_decode_html_entities(std::string_view(document), expected.text).malformed_references;
+
+			for (std::size_t split = 0; split <= document.size(); ++split)
+				check(options, document, expected, { split });
+
+			if (document.size() <= 100)
+			{
+				for (std::size_t first_split = 0; first_split <= document.size(); ++first_split)
+					for (std::size_t second_split = first_split; second_split <= document.size(); ++second_split)
+						check(options, document, expected, { first_split, second_split });
+			}
+
+			std::vector<std::size_t> every_unit;
+			for (std::size_t split = 1; split < document.size(); ++split)
+				every_unit.push_back(split);
+			check(options, document, expected, every_unit);
+		}
+	}
+
+	if (failures != 0)
+	{
+		std::cerr << failures << " split decodes differ from decoding the whole document\n";
+		return 1;
+	}
+	std::cout << "stream decoder matches whole-document decoding at every split\n";
+	return 0;
+}
@@ -0,0 +1,112 @@
+// Several threads decode through one shared const html_entities_decoder and must get exactly the
+// results of a single-threaded run. Built with -fsanitize=thread by the CMakeLists in this directory.
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "html_entities_decoder.hpp"
+
+namespace
+{
+	const char *const samples[] =
+	{
+		"plain text without references",
+		"&amp;&lt;&gt;&quot;&apos;&nbsp;&copy;&reg;",
+		"Caf&eacute; cr&egrave;me &#8364;3 &#x1F600; &#128; &#0; &#xD800;",
+		"&copy &notit; &amp= &bogus; &#; &#x; & &&&",
+		"&Longleftrightarrow;&nGt;&NotNestedGreaterGreater;&fjlig;",
+		"&#000000000000000000000000000000000000065;&#x110000;",
+	};
+
+	struct expected_results
+	{
+		std::string utf8;
+		std::u16string utf16;
+		std::u32string utf32;
+		std::wstring wide;
+		std::size_t malformed_references;
+		std::size_t length;
+	};
+
+	expected_results decode_all(const html_entities_decoder::html_entities_decoder &decoder, const std::string &input)
+	{
+		expected_results results;
+		std::u16string input16(input.begin(), input.end());
+		std::u32string input32(input.begin(), input.end());
+		std::wstring wide_input(input.begin(), input.end());
+		results.utf8 = decoder.decode_html_entities(input);
+		results.utf16 = decoder.decode_html_entities(input16);
+		results.utf32 = std::u32string(decoder.decode_html_entities_view(input32).view());
+		results.wide = decoder.decode_html_entities(wide_input);
+
+		std::string output;
+		results.malformed_references = decoder.try_decode_html_entities(std::string_view(input), output).malformed_references;
+		results.length = decoder.decoded_length(std::string_view(input));
+		return results;
+	}
+
+	bool operator==(const expected_results &left, const expected_results &right)
+	{
+		return left.utf8 == right.utf8 && left.utf16 == right.utf16 && left.utf32 == right.utf32 && left.wide == right.wide &&
+			left.malformed_references == right.malformed_references && left.length == right.length;
+	}
+}
+
+int main()
+{
+	html_entities_decoder::decoder_options attribute_options;
+	attribute_options.attribute_value = true;
+	const html_entities_decoder::html_entities_decoder decoders[] = { html_entities_decoder::html_entities_decoder(), html_entities_decoder::html_entities_decoder(attribute_options) };
+
+	std::vector<std::string> inputs;
+	for (const char *sample : samples)
+		inputs.push_back(sample);
+	std::string document;
+	for (int copy = 0; copy < 64; ++copy)
+		document += std::string(samples[copy % std::size(samples)]) + " ";
+	inputs.push_back(document);
+
+	std::vector<expected_results> expected;
+	for (const auto &decoder : decoders)
+		for (const std::string &input : inputs)
+			expected.push_back(decode_all(decoder, input));
+
+	const unsigned thread_count = 8;
+	const int rounds = 50;
+	std::atomic<bool> start{ false };
+	std::atomic<int> mismatches{ 0 };
+	std::vector<std::thread> threads;
+	for (unsigned thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([&, thread_index]
+		{
+			while (!start.load())
+				std::this_thread::yield();
+			for (int round = 0; round < rounds; ++round)
+			{
+				// Threads walk the inputs in different orders so that different calls overlap
+				for (std::size_t step = 0; step < expected.size(); ++step)
+				{
+					std::size_t index = (step + thread_index + round) % expected.size();
+					const auto &decoder = decoders[index / inputs.size()];
+					if (!(decode_all(decoder, inputs[index % inputs.size()]) == expected[index]))
+						++mismatches;
+				}
+			}
+		});
+	}
+	start = true;
+	for (std::thread &thread : threads)
+		thread.join();
+
+	if (mismatches != 0)
+	{
+		std::cerr << mismatches << " results differ from the single-threaded run\n";
+		return 1;
+	}
+	std::cout << thread_count << " threads x " << rounds << " rounds: all results match\n";
+	return 0;
+}
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Generate html_entities_table.hpp from the WHATWG entities.json list.
+
+    python3 tools/generate_entity_table.py [entities.json] [output.hpp]
+
+Named entities are stored as one packed name blob plus fixed-width code point
+arrays.  Lookup goes through a hash-and-displace perfect hash: the FNV-1a hash
+of the name selects a bucket, the bucket's seed is mixed into the hash, and the
+result selects exactly one slot.  The hash functions below must stay in sync
+with the C++ ones emitted into the header.
+
+The legacy names that HTML5 also accepts without a trailing ';' are stored as a
+small trie, so the longest legacy prefix is found in the same forward pass that
+scans the name.
+"""
+
+import json
+import os
+import sys
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+BUCKET_COUNT = 512
+SLOT_COUNT = 4096
+MASK32 = 0xFFFFFFFF
+
+
+def fnv1a(name):
+    value = FNV_OFFSET
+    for ch in name:
+        value = ((value ^ ord(ch)) * FNV_PRIME) & MASK32
+    return value
+
+
+def mix(value, seed):
+    value ^= seed
+    value ^= value >> 16
+    value = (value * 0x7FEB352D) & MASK32
+    value ^= value >> 15
+    value = (value * 0x846CA68B) & MASK32
+    value ^= value >> 16
+    return value
+
+
+def build_perfect_hash(names):
+    hashes = [fnv1a(name) for name in names]
+    if len(set(hashes)) != len(hashes):
+        sys.exit("FNV-1a collision between entity names, pick another hash")
+
+    buckets = [[] for _ in range(BUCKET_COUNT)]
+    for index, value in enumerate(hashes):
+        buckets[value % BUCKET_COUNT].append(index)
+
+    seeds = [0] * BUCKET_COUNT
+    slots = [0] * SLOT_COUNT
+    for bucket in sorted(range(BUCKET_COUNT), key=lambda b: -len(buckets[b])):
+        members = buckets[bucket]
+        if not members:
+            continue
+        for seed in range(1 << 16):
+            chosen = [mix(hashes[i], seed) % SLOT_COUNT for i in members]
+            if len(set(chosen)) == len(chosen) and all(slots[s] == 0 for s in chosen):
+                break
+        else:
+            sys.exit("no seed found for bucket %d" % bucket)
+        seeds[bucket] = seed
+        for index, slot in zip(members, chosen):
+            slots[slot] = index + 1
+    return seeds, slots
+
+
+def build_legacy_trie(legacy_names, entity_index):
+    """Returns (nodes, edges): node = [first_edge, edge_count, entity index + 1 or 0],
+    edge = (label, target node). Edges of a node are contiguous and sorted by label."""
+    children = [{}]
+    accepting = [0]
+    for name in legacy_names:
+        node = 0
+        for ch in name:
+            if ch not in children[node]:
+                children.append({})
+                accepting.append(0)
+                children[node][ch] = len(children) - 1
+            node = children[node][ch]
+        accepting[node] = entity_index[name] + 1
+
+    nodes = []
+    edges = []
+    for node, labels in enumerate(children):
+        nodes.append([len(edges), len(labels), accepting[node]])
+        for label in sorted(labels):
+            edges.append((label, labels[label]))
+    return nodes, edges
+
+
+def format_numbers(values, per_line, indent):
+    lines = []
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append(indent + ", ".join(str(v) for v in chunk) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    source = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, "entities.json")
+    target = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, "..", "html_entities_table.hpp")
+
+    with open(source, encoding="utf-8") as f:
+        raw = json.load(f)
+
+    # Only names terminated by ';' take part in the exact-match table.
+    entities = sorted((key[1:-1], value["codepoints"]) for key, value in raw.items() if key.endswith(";"))
+    names = [name for name, _ in entities]
+    seeds, slots = build_perfect_hash(names)
+
+    entity_index = {name: index for index, name in enumerate(names)}
+    legacy_names = sorted(key[1:] for key in raw if not key.endswith(";"))
+    missing = [name for name in legacy_names if name not in entity_index]
+    if missing:
+        sys.exit("legacy names without a ';' form: %s" % ", ".join(missing))
+    legacy_nodes, legacy_edges = build_legacy_trie(legacy_names, entity_index)
+
+    blob = "".join(names)
+    offsets = []
+    position = 0
+    for name in names:
+        offsets.append(position)
+        position += len(name)
+    if position > 0xFFFF:
+        sys.exit("name blob does not fit 16-bit offsets")
+
+    out = []
+    out.append("// Generated by tools/generate_entity_table.py from tools/entities.json. Do not edit by hand.")
+    out.append("#pragma once")
+    out.append("#ifndef __HTML_ENTITIES_TABLE__")
+    out.append("#define __HTML_ENTITIES_TABLE__")
+    out.append("")
+    out.append("#include <cstddef>")
+    out.append("#include <cstdint>")
+    out.append("")
+    out.append("namespace html_entities_decoder")
+    out.append("{")
+    out.append("\tnamespace entity_table")
+    out.append("\t{")
+    out.append("\t\tstruct entity")
+    out.append("\t\t{")
+    out.append("\t\t\tstd::uint16_t name_offset;")
+    out.append("\t\t\tstd::uint8_t name_length;")
+    out.append("\t\t\tstd::uint8_t code_point_count;")
+    out.append("\t\t\tchar32_t code_points[2];")
+    out.append("\t\t};")
+    out.append("")
+    out.append("\t\t// Node of the trie of legacy names, which may appear without the trailing ';'")
+    out.append("\t\tstruct legacy_node")
+    out.append("\t\t{")
+    out.append("\t\t\tstd::uint16_t first_edge;")
+    out.append("\t\t\tstd::uint8_t edge_count;")
+    out.append("\t\t\tstd::uint16_t entity;\t\t// entity index + 1, 0 if no legacy name ends here")
+    out.append("\t\t};")
+    out.append("")
+    out.append("\t\tstruct legacy_edge")
+    out.append("\t\t{")
+    out.append("\t\t\tchar label;")
+    out.append("\t\t\tstd::uint16_t target;")
+    out.append("\t\t};")
+    out.append("")
+    out.append("\t\tinline constexpr std::size_t entity_count = %d;" % len(entities))
+    out.append("\t\tinline constexpr std::size_t max_name_length = %d;" % max(len(n) for n in names))
+    out.append("\t\tinline constexpr std::size_t legacy_node_count = %d;" % len(legacy_nodes))
+    out.append("\t\tinline constexpr std::size_t legacy_edge_count = %d;" % len(legacy_edges))
+    out.append("\t\tinline constexpr std::uint32_t bucket_count = %d;" % BUCKET_COUNT)
+    out.append("\t\tinline constexpr std::uint32_t slot_count = %d;" % SLOT_COUNT)
+    out.append("\t\tinline constexpr std::uint32_t name_hash_offset = %du;" % FNV_OFFSET)
+    out.append("\t\tinline constexpr std::uint32_t name_hash_prime = %du;" % FNV_PRIME)
+    out.append("")
+    out.append("\t\tconstexpr std::uint32_t name_hash_step(std::uint32_t hash, std::uint32_t code_unit) noexcept")
+    out.append("\t\t{")
+    out.append("\t\t\treturn (hash ^ code_unit) * name_hash_prime;")
+    out.append("\t\t}")
+    out.append("")
+    out.append("\t\tconstexpr std::uint32_t slot_of(std::uint32_t hash, std::uint32_t seed) noexcept")
+    out.append("\t\t{")
+    out.append("\t\t\thash ^= seed;")
+    out.append("\t\t\thash ^= hash >> 16;")
+    out.append("\t\t\thash *= 0x7FEB352Du;")
+    out.append("\t\t\thash ^= hash >> 15;")
+    out.append("\t\t\thash *= 0x846CA68Bu;")
+    out.append("\t\t\thash ^= hash >> 16;")
+    out.append("\t\t\treturn hash % slot_count;")
+    out.append("\t\t}")
+    out.append("")
+    out.append("\t\tinline constexpr char names[] =")
+    for start in range(0, len(blob), 96):
+        out.append('\t\t\t"%s"' % blob[start:start + 96])
+    out[-1] += ";"
+    out.append("")
+    out.append("\t\tinline constexpr entity entities[entity_count] =")
+    out.append("\t\t{")
+    for (name, code_points), offset in zip(entities, offsets):
+        padded = list(code_points) + [0] * (2 - len(code_points))
+        out.append("\t\t\t{ %d, %d, %d, { 0x%05X, 0x%05X } },\t// %s" % (offset, len(name), len(code_points), padded[0], padded[1], name))
+    out.append("\t\t};")
+    out.append("")
+    out.append("\t\tinline constexpr std::uint16_t bucket_seeds[bucket_count] =")
+    out.append("\t\t{")
+    out.append(format_numbers(seeds, 16, "\t\t\t"))
+    out.append("\t\t};")
+    out.append("")
+    out.append("\t\t// entity index + 1, 0 marks an empty slot")
+    out.append("\t\tinline constexpr std::uint16_t slots[slot_count] =")
+    out.append("\t\t{")
+    out.append(format_numbers(slots, 16, "\t\t\t"))
+    out.append("\t\t};")
+    out.append("")
+    out.append("\t\t// node 0 is the root")
+    out.append("\t\tinline constexpr legacy_node legacy_nodes[legacy_node_count] =")
+    out.append("\t\t{")
+    for first_edge, edge_count, entity in legacy_nodes:
+        comment = "\t// %s" % names[entity - 1] if entity else ""
+        out.append("\t\t\t{ %d, %d, %d },%s" % (first_edge, edge_count, entity, comment))
+    out.append("\t\t};")
+    out.append("")
+    out.append("\t\tinline constexpr legacy_edge legacy_edges[legacy_edge_count] =")
+    out.append("\t\t{")
+    for start in range(0, len(legacy_edges), 8):
+        chunk = legacy_edges[start:start + 8]
+        out.append("\t\t\t" + " ".join("{ '%s', %d }," % (label, target) for label, target in chunk))
+    out.append("\t\t};")
+    out.append("\t}")
+    out.append("}")
+    out.append("")
+    out.append("#endif")
+
+    with open(target, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()